@@ -1,26 +1,393 @@
 #include "Polynomials.hpp"
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <numeric>
 #include <vector>
-#include <iostream>
+
+namespace
+{
+/*
+    Coefficients of the consecutive degrees trailing, trailing + 1, ... with no zero at
+    either end, the zero polynomial has no coefficient.
+*/
+struct DenseLaurent
+{
+    std::vector<double> coefficients;
+    DEGREE_TYPE trailing = 0;
+};
+
+// a coefficient left by an exact division below this (relative to the dividend) is rounding noise
+constexpr double REMAINDER_TOLERANCE = 1e-9;
+
+// integers up to 2^53 are exact in a double
+constexpr double EXACT_INTEGER_BOUND = 9007199254740992.0;
+
+void trim(DenseLaurent &p)
+{
+    size_t first = 0, last = p.coefficients.size();
+    while (last > 0 && p.coefficients[last - 1] == 0)
+        last--;
+    while (first < last && p.coefficients[first] == 0)
+        first++;
+
+    p.coefficients = std::vector<double>(p.coefficients.begin() + first, p.coefficients.begin() + last);
+    p.trailing = p.coefficients.empty() ? 0 : p.trailing + (DEGREE_TYPE)first;
+}
+
+DenseLaurent toDense(const Polynomial &p)
+{
+    DenseLaurent dense;
+    bool found = false;
+    DEGREE_TYPE low = 0, high = 0;
+    for (const Term &term : p.Terms)
+    {
+        if (term.coefficient == 0)
+            continue;
+        low = found ? std::min(low, term.degree) : term.degree;
+        high = found ? std::max(high, term.degree) : term.degree;
+        found = true;
+    }
+    if (!found)
+        return dense;
+
+    dense.trailing = low;
+    dense.coefficients.assign(high - low + 1, 0);
+    for (const Term &term : p.Terms)
+        dense.coefficients[term.degree - low] += term.coefficient;
+    trim(dense);
+    return dense;
+}
+
+Polynomial fromDense(const DenseLaurent &dense)
+{
+    if (dense.coefficients.empty())
+        return Polynomial();
+
+    // every exponent of the range is stored, zeros included
+    std::vector<Term> terms(dense.coefficients.size());
+    for (size_t i = 0; i < dense.coefficients.size(); i++)
+        terms[i] = Term{dense.coefficients[i], (DEGREE_TYPE)(dense.trailing + (DEGREE_TYPE)i)};
+    return Polynomial(terms, terms.front().degree, terms.back().degree);
+}
+
+DEGREE_TYPE leadingDegree(const DenseLaurent &p) { return p.trailing + (DEGREE_TYPE)p.coefficients.size() - 1; }
+
+// a + factor * b
+DenseLaurent combine(const DenseLaurent &a, const DenseLaurent &b, double factor)
+{
+    if (b.coefficients.empty())
+        return a;
+
+    DenseLaurent sum;
+    sum.trailing = a.coefficients.empty() ? b.trailing : std::min(a.trailing, b.trailing);
+    const DEGREE_TYPE high = a.coefficients.empty() ? leadingDegree(b) : std::max(leadingDegree(a), leadingDegree(b));
+    sum.coefficients.assign(high - sum.trailing + 1, 0);
+
+    for (size_t i = 0; i < a.coefficients.size(); i++)
+        sum.coefficients[a.trailing - sum.trailing + i] += a.coefficients[i];
+    for (size_t i = 0; i < b.coefficients.size(); i++)
+        sum.coefficients[b.trailing - sum.trailing + i] += factor * b.coefficients[i];
+    trim(sum);
+    return sum;
+}
+
+double maxAbsCoefficient(const DenseLaurent &p)
+{
+    double norm = 0;
+    for (double coefficient : p.coefficients)
+        norm = std::max(norm, std::abs(coefficient));
+    return norm;
+}
+
+bool isIntegral(const DenseLaurent &p)
+{
+    for (double coefficient : p.coefficients)
+    {
+        if (coefficient != std::round(coefficient) || std::abs(coefficient) >= EXACT_INTEGER_BOUND)
+            return false;
+    }
+    return true;
+}
+
+// gcd of the coefficients of an integral polynomial, 0 for the zero polynomial
+double content(const DenseLaurent &p)
+{
+    int64_t divisor = 0;
+    for (double coefficient : p.coefficients)
+        divisor = std::gcd(divisor, (int64_t)coefficient);
+    return (double)divisor;
+}
+
+// integral polynomial divided by its content and by the power of t, positive leading coefficient
+DenseLaurent primitivePart(DenseLaurent p)
+{
+    const double divisor = content(p) * ((!p.coefficients.empty() && p.coefficients.back() < 0) ? -1 : 1);
+    for (double &coefficient : p.coefficients)
+        coefficient /= divisor;
+    p.trailing = 0;
+    return p;
+}
+
+/*
+    Value at t of the polynomial without its power of t, false when it may not be exact
+    in a double.
+*/
+bool exactValue(const DenseLaurent &p, double t, double &value)
+{
+    double bound = 0, power = 1;
+    value = 0;
+    for (double coefficient : p.coefficients)
+    {
+        bound += std::abs(coefficient) * power;
+        value += coefficient * power;
+        power *= std::abs(t);
+    }
+    return bound < EXACT_INTEGER_BOUND;
+}
+
+/*
+    Exact division a = b * quotient, b not zero.
+    When both are integral and b is primitive the quotient must be integral (Gauss lemma),
+    which gives early exits: the end coefficients and the values at 1, -1, 2 must be
+    divisible, and the long division stops at the first non integral quotient coefficient.
+*/
+bool exactDivide(const DenseLaurent &a, const DenseLaurent &b, DenseLaurent &quotient)
+{
+    quotient = DenseLaurent();
+    if (a.coefficients.empty())
+        return true;
+
+    const std::vector<double> &dividend = a.coefficients, &divisor = b.coefficients;
+    if (dividend.size() < divisor.size())
+        return false;
+
+    const bool integral = isIntegral(a) && isIntegral(b) && content(b) == 1;
+    if (integral)
+    {
+        if (std::fmod(dividend.back(), divisor.back()) != 0 || std::fmod(dividend.front(), divisor.front()) != 0)
+            return false;
+
+        for (double t : {1.0, -1.0, 2.0})
+        {
+            double valueA, valueB;
+            if (!exactValue(a, t, valueA) || !exactValue(b, t, valueB))
+                continue;
+            if (valueB == 0 ? valueA != 0 : std::fmod(valueA, valueB) != 0)
+                return false;
+        }
+    }
+
+    std::vector<double> remainder(dividend);
+    std::vector<double> coefficients(dividend.size() - divisor.size() + 1, 0);
+    for (size_t k = coefficients.size(); k-- > 0;)
+    {
+        const double coefficient = remainder[k + divisor.size() - 1] / divisor.back();
+        if (integral && coefficient != std::round(coefficient))
+            return false;
+
+        coefficients[k] = coefficient;
+        for (size_t j = 0; j < divisor.size(); j++)
+            remainder[k + j] -= coefficient * divisor[j];
+        remainder[k + divisor.size() - 1] = 0;
+    }
+
+    const double tolerance = integral ? 0 : REMAINDER_TOLERANCE * std::max(1.0, maxAbsCoefficient(a));
+    for (size_t j = 0; j + 1 < divisor.size(); j++)
+    {
+        if (std::abs(remainder[j]) > tolerance)
+            return false;
+    }
+
+    quotient.coefficients = std::move(coefficients);
+    quotient.trailing = a.trailing - b.trailing;
+    trim(quotient);
+    return true;
+}
+
+/*
+    Heuristic gcd (Char, Geddes, Gonnet) of primitive polynomials with trailing degree 0:
+    the gcd of the values at a large integer xi is read back in base xi with digits in
+    (-xi/2, xi/2] and kept when it divides both. Gives up when the values don't fit in 62 bits.
+*/
+bool heuristicGcd(const DenseLaurent &a, const DenseLaurent &b, DenseLaurent &gcd)
+{
+    const size_t length = std::max(a.coefficients.size(), b.coefficients.size());
+    int64_t xi = 2 * (int64_t)std::min(maxAbsCoefficient(a), maxAbsCoefficient(b)) + 2;
+
+    for (int attempt = 0; attempt < 6; attempt++)
+    {
+        if (std::log2((double)xi) * length + std::log2(std::max(maxAbsCoefficient(a), maxAbsCoefficient(b)) + 1) > 61)
+            return false;
+
+        int64_t valueA = 0, valueB = 0;
+        for (size_t i = a.coefficients.size(); i-- > 0;)
+            valueA = valueA * xi + (int64_t)a.coefficients[i];
+        for (size_t i = b.coefficients.size(); i-- > 0;)
+            valueB = valueB * xi + (int64_t)b.coefficients[i];
+
+        DenseLaurent candidate;
+        for (int64_t gamma = std::gcd(valueA, valueB); gamma != 0;)
+        {
+            int64_t digit = gamma % xi;
+            if (digit > xi / 2)
+                digit -= xi;
+            candidate.coefficients.push_back((double)digit);
+            gamma = (gamma - digit) / xi;
+        }
+        trim(candidate);
+
+        DenseLaurent unused;
+        if (!candidate.coefficients.empty())
+        {
+            candidate = primitivePart(candidate);
+            if (exactDivide(a, candidate, unused) && exactDivide(b, candidate, unused))
+            {
+                gcd = candidate;
+                return true;
+            }
+        }
+        xi = xi * 73794 / 27011; // ~ xi * 2.73, avoids powers of the previous points
+    }
+    return false;
+}
+
+// coefficients modulo a prime, lowest degree first, no zero leading coefficient
+using ModularPolynomial = std::vector<int64_t>;
+
+int64_t powerModulo(int64_t base, int64_t exponent, int64_t prime)
+{
+    int64_t result = 1;
+    for (base %= prime; exponent > 0; exponent /= 2, base = base * base % prime)
+    {
+        if (exponent % 2 == 1)
+            result = result * base % prime;
+    }
+    return result;
+}
+
+void trim(ModularPolynomial &p)
+{
+    while (!p.empty() && p.back() == 0)
+        p.pop_back();
+}
+
+ModularPolynomial reduceModulo(const DenseLaurent &p, int64_t prime)
+{
+    ModularPolynomial reduced(p.coefficients.size());
+    for (size_t i = 0; i < reduced.size(); i++)
+        reduced[i] = (((int64_t)p.coefficients[i] % prime) + prime) % prime;
+    trim(reduced);
+    return reduced;
+}
+
+// monic gcd by Euclid's algorithm over the integers modulo prime
+ModularPolynomial gcdModulo(ModularPolynomial a, ModularPolynomial b, int64_t prime)
+{
+    while (!b.empty())
+    {
+        const int64_t inverse = powerModulo(b.back(), prime - 2, prime);
+        for (size_t k = a.size(); k-- >= b.size();)
+        {
+            const int64_t factor = a[k] * inverse % prime;
+            for (size_t j = 0; j < b.size(); j++)
+                a[k - b.size() + 1 + j] = (a[k - b.size() + 1 + j] - factor * b[j] % prime + prime) % prime;
+        }
+        trim(a);
+        std::swap(a, b);
+    }
+
+    const int64_t inverse = a.empty() ? 0 : powerModulo(a.back(), prime - 2, prime);
+    for (int64_t &coefficient : a)
+        coefficient = coefficient * inverse % prime;
+    return a;
+}
+
+/*
+    Modular gcd of primitive polynomials with trailing degree 0: the monic gcd modulo a few
+    31-bit primes, scaled by the gcd of the leading coefficients, is lifted from one prime
+    or from two by Chinese remaindering (coefficients up to 2^53) and kept when it divides
+    both. Primes whose image has a larger degree are unlucky and skipped.
+*/
+bool modularGcd(const DenseLaurent &a, const DenseLaurent &b, DenseLaurent &gcd)
+{
+    static constexpr int64_t PRIMES[] = {2147483647, 2147483629, 2147483587, 2147483579, 2147483563, 2147483549, 2147483543, 2147483497};
+    const int64_t leadingGcd = std::gcd((int64_t)a.coefficients.back(), (int64_t)b.coefficients.back());
+
+    ModularPolynomial previous;
+    int64_t previousPrime = 0;
+    for (int64_t prime : PRIMES)
+    {
+        if ((int64_t)a.coefficients.back() % prime == 0 || (int64_t)b.coefficients.back() % prime == 0)
+            continue;
+
+        ModularPolynomial image = gcdModulo(reduceModulo(a, prime), reduceModulo(b, prime), prime);
+        if (image.size() == 1)
+        {
+            gcd = DenseLaurent{std::vector<double>{1}, 0};
+            return true;
+        }
+        if (!previous.empty() && previous.size() < image.size())
+            continue;
+        if (previous.size() != image.size())
+            previous.clear();
+
+        for (int64_t &coefficient : image)
+            coefficient = coefficient * (leadingGcd % prime + prime) % prime;
+
+        std::vector<DenseLaurent> candidates(1, DenseLaurent{std::vector<double>(image.size()), 0});
+        for (size_t i = 0; i < image.size(); i++)
+            candidates[0].coefficients[i] = (double)((image[i] > prime / 2) ? image[i] - prime : image[i]);
+
+        if (!previous.empty())
+        {
+            // x = r1 + p1 * ((r2 - r1) / p1 mod p2), taken in (-p1 p2 / 2, p1 p2 / 2]
+            const int64_t modulus = previousPrime * prime, inverse = powerModulo(previousPrime % prime, prime - 2, prime);
+            DenseLaurent lifted{std::vector<double>(image.size()), 0};
+            for (size_t i = 0; i < image.size(); i++)
+            {
+                const int64_t step = ((image[i] - previous[i] % prime) % prime + prime) % prime * inverse % prime;
+                int64_t value = previous[i] + previousPrime * step;
+                if (value > modulus / 2)
+                    value -= modulus;
+                lifted.coefficients[i] = (double)value;
+            }
+            if (isIntegral(lifted))
+                candidates.push_back(lifted);
+        }
+
+        for (const DenseLaurent &candidate : candidates)
+        {
+            DenseLaurent unused;
+            const DenseLaurent primitive = primitivePart(candidate);
+            if (exactDivide(a, primitive, unused) && exactDivide(b, primitive, unused))
+            {
+                gcd = primitive;
+                return true;
+            }
+        }
+        previous = image;
+        previousPrime = prime;
+    }
+    return false;
+}
+}
 
 Polynomial::Polynomial()
     : Terms(std::vector<Term>{Term{0, 0}}), _trailingTermDegree(0), _leadingTermDegree(0) {}
 
-Polynomial::Polynomial(const std::vector<Term> terms)
+Polynomial::Polynomial(std::vector<Term> terms)
+    : _trailingTermDegree(terms.empty() ? 0 : terms.front().degree), _leadingTermDegree(terms.empty() ? 0 : terms.front().degree)
 {
     Terms = std::move(terms);
 
-    for (size_t i = 0; i < terms.size(); i++)
+    for (size_t i = 0; i < Terms.size(); i++)
     {
-        if (terms.at(i).degree < _leadingTermDegree)
-            _leadingTermDegree = terms.at(i).degree;
-        else if (terms.at(i).
-        degree > _trailingTermDegree)
-            _trailingTermDegree = terms.at(i).degree;
+        if (Terms.at(i).degree < _trailingTermDegree)
+            _trailingTermDegree = Terms.at(i).degree;
+        else if (Terms.at(i).degree > _leadingTermDegree)
+            _leadingTermDegree = Terms.at(i).degree;
     }
-
-    std::cout << "new poly: " << this->toString() << std::endl;
-    std::cout << "trailing degree:" << _trailingTermDegree << ", leading degree:" << _leadingTermDegree << std::endl;
 }
 
 /**
@@ -55,44 +422,42 @@ bool Polynomial::operator==(const Polynomial &n) const { return this->Terms == n
 bool Polynomial::operator!=(const Polynomial &n) const { return this->Terms != n.Terms; }
 
 
-Polynomial Polynomial::operator+(const Polynomial &n) const
-{
-    const Polynomial& leading = (_leadingTermDegree < n.getLeadingDegree()) ? *this: n;
-    const Polynomial& trailing = (leading == n)? *this: n;
+Polynomial Polynomial::operator+(const Polynomial &n) const { return fromDense(combine(toDense(*this), toDense(n), 1)); }
+Polynomial Polynomial::operator-(const Polynomial &n) const { return fromDense(combine(toDense(*this), toDense(n), -1)); }
 
-    Polynomial newPoly(trailing);
-    newPoly.densify(trailing._trailingTermDegree, leading._leadingTermDegree);
+Polynomial Polynomial::operator*(const Polynomial &n) const
+{
+    const DenseLaurent a = toDense(*this), b = toDense(n);
+    if (a.coefficients.empty() || b.coefficients.empty())
+        return Polynomial();
 
-    for (size_t i = 0, j = 0; i < newPoly.Terms.size(); i++)
+    DenseLaurent product{std::vector<double>(a.coefficients.size() + b.coefficients.size() - 1, 0), (DEGREE_TYPE)(a.trailing + b.trailing)};
+    for (size_t i = 0; i < a.coefficients.size(); i++)
     {
-        if (newPoly.Terms.at(i).degree == trailing.Terms.at(j).degree)
-        {
-            newPoly.Terms[i] += trailing.Terms.at(j);
-            j += (Terms.size() - 1 > j) ? 1 : 0; // ensures j doesnt go out of range
-        }
+        for (size_t j = 0; j < b.coefficients.size(); j++)
+            product.coefficients[i + j] += a.coefficients[i] * b.coefficients[j];
     }
-
-    return std::move(newPoly);
-}
-
-/*
-Polynomial Polynomial::operator+(const Polynomial &n) const
-{
-
+    return fromDense(product);
 }
 
-Polynomial Polynomial::operator-(const Polynomial &n) const
+/**
+ * @brief Exact division of Laurent polynomials.
+ * @throws PolynomialArithmeticException if @p n is zero or doesn't divide the polynomial.
+ */
+Polynomial Polynomial::operator/(const Polynomial &n) const
 {
-
+    DenseLaurent quotient;
+    if (toDense(n).coefficients.empty())
+        throw kle::PolynomialArithmeticException("/", "zero division exception.");
+    if (!exactDivide(toDense(*this), toDense(n), quotient))
+        throw kle::PolynomialArithmeticException("/", "the division has a non zero remainder.");
+    return fromDense(quotient);
 }
 
-Polynomial Polynomial::operator*(const Polynomial &n) const;
-Polynomial Polynomial::operator/(const Polynomial &n) const;
-
-void Polynomial::operator-=(const Polynomial &n);
-void Polynomial::operator*=(const Polynomial &n);
-void Polynomial::operator/=(const Polynomial &n);
-*/
+void Polynomial::operator+=(const Polynomial &n) { *this = *this + n; }
+void Polynomial::operator-=(const Polynomial &n) { *this = *this - n; }
+void Polynomial::operator*=(const Polynomial &n) { *this = *this * n; }
+void Polynomial::operator/=(const Polynomial &n) { *this = *this / n; }
 
 // scalar operations
 bool Polynomial::operator==(const double scalar) const
@@ -157,6 +522,63 @@ void Polynomial::operator/=(const double scalar)
 }
 
 // other polynomial operation
+
+/**
+ * @brief Greatest common divisor of two Laurent polynomials with integer coefficients.
+ * The gcd is only defined up to a unit +-t^k, it is returned with trailing degree 0 and a
+ * positive leading coefficient, gcd(0, 0) = 0. The heuristic (evaluation) gcd is tried
+ * first, a modular gcd over a few large primes is the fallback.
+ * @throws PolynomialArithmeticException if a coefficient is not an integer or the gcd has
+ * coefficients beyond 2^53.
+ */
+Polynomial Polynomial::gcd(const Polynomial &a, const Polynomial &b)
+{
+    const DenseLaurent denseA = toDense(a), denseB = toDense(b);
+    if (!isIntegral(denseA) || !isIntegral(denseB))
+        throw kle::PolynomialArithmeticException("gcd", "only polynomials with integer coefficients are supported.");
+
+    if (denseA.coefficients.empty() || denseB.coefficients.empty())
+    {
+        DenseLaurent other = denseA.coefficients.empty() ? denseB : denseA;
+        const double scale = content(other);
+        other = primitivePart(other);
+        for (double &coefficient : other.coefficients)
+            coefficient *= scale;
+        return fromDense(other);
+    }
+
+    const double commonContent = std::gcd((int64_t)content(denseA), (int64_t)content(denseB));
+    const DenseLaurent primitiveA = primitivePart(denseA), primitiveB = primitivePart(denseB);
+
+    DenseLaurent divisor{std::vector<double>{1}, 0};
+    if (primitiveA.coefficients.size() > 1 && primitiveB.coefficients.size() > 1 && !heuristicGcd(primitiveA, primitiveB, divisor)
+        && !modularGcd(primitiveA, primitiveB, divisor))
+        throw kle::PolynomialArithmeticException("gcd", "the coefficients of the gcd are too large to be computed exactly.");
+
+    for (double &coefficient : divisor.coefficients)
+        coefficient *= commonContent;
+    return fromDense(divisor);
+}
+
+double Polynomial::evaluate(double t) const
+{
+    double value = 0;
+    for (const Term &term : Terms)
+        value += term.coefficient * std::pow(t, term.degree);
+    return value;
+}
+
+bool Polynomial::isZero() const { return toDense(*this).coefficients.empty(); }
+
+/**
+ * @brief True for the units of the Laurent polynomial ring over the integers, +-t^k.
+ */
+bool Polynomial::isUnit() const
+{
+    const DenseLaurent dense = toDense(*this);
+    return dense.coefficients.size() == 1 && std::abs(dense.coefficients[0]) == 1;
+}
+
 void Polynomial::simplify()
 {
     std::vector<Term> simplifiedVector;
@@ -237,7 +659,6 @@ std::string Polynomial::toString() const
 
 bool Polynomial::isMonomial() const
 {
-    std::cout << Terms.size() << std::endl;
     return Terms.size() == 1;
 }
 
@@ -120,6 +120,10 @@ public:
     void operator/=(const double scalar);
 
     // other polynomial operation
+    static Polynomial gcd(const Polynomial &a, const Polynomial &b);
+    double evaluate(double t) const;
+    bool isZero() const;
+    bool isUnit() const;
     void simplify();
     void densify();
     void densify(const DEGREE_TYPE startDegree, const DEGREE_TYPE endDegree);
@@ -0,0 +1,50 @@
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "knot.hpp"
+#include "diagramGenerator.hpp"
+#include "gaussDiagram.hpp"
+
+using namespace std;
+
+// clang++ -std=c++20 -O2 src/benchmarks.cpp src/Polynomials.cpp src/knot.cpp src/presentation.cpp src/diagramGenerator.cpp src/gaussDiagram.cpp -I/opt/homebrew/include -L/opt/homebrew/lib -larmadillo -o bench
+
+template <typename Function>
+double timeMilliseconds(Function function, int repetitions)
+{
+    const auto start = chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; i++)
+        function();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / repetitions;
+}
+
+void benchmarkVassiliev()
+{
+    cout << "______________________________[Vassiliev v2/v3]______________________________" << endl;
+    // v2 is O(n log n) against O(n^2), v3 O(n^1.5 log n) against O(n^3)
+    cout << "crossings\tv2 (ms)\tv2 brute (ms)\tv3 O(n^1.5 log n) (ms)\tv3 brute (ms)" << endl;
+    DiagramGenerator generator(1);
+
+    for (size_t crossings : {25, 50, 100, 200, 400})
+    {
+        const GaussDiagram diagram(Knot(generator.braidClosure(6, crossings)));
+        const int repetitions = (crossings <= 100) ? 20 : 3;
+        int64_t sink = 0;
+
+        const double v2 = timeMilliseconds([&] { sink += diagram.v2(); }, repetitions);
+        const double v2Brute = timeMilliseconds([&] { sink -= diagram.v2BruteForce(); }, repetitions);
+        const double v3 = timeMilliseconds([&] { sink += diagram.v3(); }, repetitions);
+        const double v3Brute = timeMilliseconds([&] { sink -= diagram.v3BruteForce(); }, repetitions);
+
+        if (sink != 0)
+            cout << "fast and brute force formulas disagree!" << endl;
+        cout << diagram.getChordCount() << "\t" << v2 << "\t" << v2Brute << "\t" << v3 << "\t" << v3Brute << endl;
+    }
+}
+
+int main()
+{
+    benchmarkVassiliev();
+    return 0;
+}
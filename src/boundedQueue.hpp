@@ -0,0 +1,161 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+
+/**
+ * @class BoundedQueue
+ * @brief Fixed-capacity lock-free queue for any number of producers and consumers.
+ *
+ * Every slot carries a sequence number telling whether it is free for the producer of a
+ * given turn or holds the value for the consumer of that turn (D. Vyukov's bounded queue),
+ * so pushing and popping only cost a compare-and-swap on the shared position. push() and
+ * pop() block while the queue is full or empty, which is the backpressure between stages:
+ * they yield a bounded number of times, then park on the slot they need with atomic wait.
+ *
+ * @tparam T Default-constructible, movable value type.
+ */
+template <typename T>
+class BoundedQueue
+{
+public:
+    /*
+        @param capacity Rounded up to a power of two, at least 2.
+    */
+    explicit BoundedQueue(size_t capacity) : _mask(roundCapacity(capacity) - 1), _slots(new Slot[_mask + 1])
+    {
+        for (size_t i = 0; i <= _mask; i++)
+            _slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    BoundedQueue(const BoundedQueue &) = delete;
+    BoundedQueue &operator=(const BoundedQueue &) = delete;
+
+    /*
+        @brief Moves @p value in the queue unless it is full.
+        @return False (and @p value untouched) when the queue is full.
+    */
+    bool tryPush(T &value)
+    {
+        size_t position = _tail.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Slot &slot = _slots[position & _mask];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = (std::ptrdiff_t)sequence - (std::ptrdiff_t)position;
+
+            if (difference == 0)
+            {
+                if (_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.value = std::move(value);
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    slot.sequence.notify_all();
+                    return true;
+                }
+            }
+            else if (difference < 0)
+                return false;
+            else
+                position = _tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    /*
+        @brief Takes the oldest value unless the queue is empty.
+        @return False when the queue is empty.
+    */
+    bool tryPop(T &value)
+    {
+        size_t position = _head.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Slot &slot = _slots[position & _mask];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = (std::ptrdiff_t)sequence - (std::ptrdiff_t)(position + 1);
+
+            if (difference == 0)
+            {
+                if (_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    value = std::move(slot.value);
+                    slot.sequence.store(position + _mask + 1, std::memory_order_release);
+                    slot.sequence.notify_all();
+                    return true;
+                }
+            }
+            else if (difference < 0)
+                return false;
+            else
+                position = _head.load(std::memory_order_relaxed);
+        }
+    }
+
+    // blocking versions, the caller yields, then sleeps until there is room or a value
+    void push(T value)
+    {
+        for (unsigned attempt = 0; !tryPush(value); attempt++)
+        {
+            if (attempt < SPINS_BEFORE_PARKING)
+                std::this_thread::yield();
+            else
+                park(_tail.load(std::memory_order_relaxed), 0);
+        }
+    }
+
+    T pop()
+    {
+        T value;
+        for (unsigned attempt = 0; !tryPop(value); attempt++)
+        {
+            if (attempt < SPINS_BEFORE_PARKING)
+                std::this_thread::yield();
+            else
+                park(_head.load(std::memory_order_relaxed), 1);
+        }
+        return value;
+    }
+
+    size_t capacity() const { return _mask + 1; }
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    static constexpr unsigned SPINS_BEFORE_PARKING = 64;
+
+    /*
+        @brief Sleeps while the slot of @p position isn't ready for its turn yet, that is while its
+        sequence is behind position + @p offset (0 for a producer, 1 for a consumer).
+        Returns at once if the turn was taken meanwhile, the caller then retries on the new position.
+        Several turns can wait on the same slot, hence notify_all in tryPush() and tryPop().
+    */
+    void park(size_t position, size_t offset)
+    {
+        Slot &slot = _slots[position & _mask];
+        const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if ((std::ptrdiff_t)sequence - (std::ptrdiff_t)(position + offset) < 0)
+            slot.sequence.wait(sequence, std::memory_order_acquire);
+    }
+
+    static size_t roundCapacity(size_t capacity)
+    {
+        size_t rounded = 2;
+        while (rounded < capacity)
+            rounded *= 2;
+        return rounded;
+    }
+
+    const size_t _mask;
+    std::unique_ptr<Slot[]> _slots;
+
+    // producers and consumers work on separate cache lines
+    alignas(64) std::atomic<size_t> _tail{0};
+    alignas(64) std::atomic<size_t> _head{0};
+};
@@ -0,0 +1,293 @@
+#include "diagramGenerator.hpp"
+#include "exception.hpp"
+#include <cstdlib>
+#include <string>
+
+// arcs are stored on 16 bits, a diagram with n crossings uses 2n labels
+static constexpr size_t MAX_CROSSINGS = UINT16_MAX / 2;
+
+DiagramGenerator::DiagramGenerator(uint64_t seed) : _engine(seed) {}
+
+/*
+    @brief Generates the closure of a random braid word.
+    @param strands Number of strands of the braid.
+    @param length Number of random generators in the word.
+    Generators that would cancel the previous one are redrawn. When the closure has more
+    than one component, one generator is appended per pair of neighbouring cycles so the
+    result is always a knot, the returned diagram can therefore have up to strands - 1
+    more crossings than requested.
+*/
+std::vector<crossing> DiagramGenerator::braidClosure(uint16_t strands, size_t length)
+{
+    if (strands == 0)
+        throw kle::DiagramGenerationException("a braid needs at least one strand.");
+    if (strands == 1)
+        return std::vector<crossing>();
+    // labels 1 .. strands for the entering strands, then two per crossing
+    if (length > MAX_CROSSINGS || strands + 1 + 2 * (length + strands - 1) > UINT16_MAX)
+        throw kle::DiagramGenerationException("a braid closure with " + std::to_string(strands) + " strands and " + std::to_string(length)
+                                              + " generators needs more than " + std::to_string(UINT16_MAX) + " arc labels.");
+
+    std::vector<int32_t> word;
+    word.reserve(length + strands - 1);
+
+    // position of every starting strand after the word is applied
+    _strandArcs.resize(strands);
+    for (uint16_t i = 0; i < strands; i++)
+        _strandArcs[i] = i;
+
+    int32_t previous = 0;
+    for (size_t k = 0; k < length; k++)
+    {
+        int32_t letter;
+        do
+        {
+            letter = 1 + (int32_t)uniform(strands - 1);
+            letter = (uniform(2) == 0) ? letter : -letter;
+        } while (letter == -previous);
+
+        std::swap(_strandArcs[std::abs(letter) - 1], _strandArcs[std::abs(letter)]);
+        word.push_back(letter);
+        previous = letter;
+    }
+
+    // the closure glues the end of position i to the start of position i, merge the cycles
+    _strandRoots.resize(strands);
+    for (uint16_t i = 0; i < strands; i++)
+        _strandRoots[i] = i;
+    for (uint16_t i = 0; i < strands; i++)
+        _strandRoots[findStrand(_strandArcs[i])] = findStrand(i);
+
+    for (uint16_t i = 0; i + 1 < strands; i++)
+    {
+        if (findStrand(i) != findStrand(i + 1))
+        {
+            word.push_back((uniform(2) == 0) ? i + 1 : -(i + 1));
+            _strandRoots[findStrand(i)] = findStrand(i + 1);
+        }
+    }
+
+    // strand i enters the braid on arc i + 1, every crossing creates two new arcs
+    std::vector<crossing> planarDiagram;
+    planarDiagram.reserve(word.size());
+    for (uint16_t i = 0; i < strands; i++)
+        _strandArcs[i] = i + 1;
+
+    uint16_t nextArc = strands + 1;
+    for (int32_t letter : word)
+    {
+        const size_t i = std::abs(letter) - 1;
+        const uint16_t left = _strandArcs[i], right = _strandArcs[i + 1];
+        const uint16_t leftOut = nextArc++, rightOut = nextArc++;
+
+        // sigma_i passes the left strand over the right one
+        if (letter > 0)
+            planarDiagram.emplace_back(left, rightOut, leftOut, right, true);
+        else
+            planarDiagram.emplace_back(right, leftOut, rightOut, left, false);
+
+        _strandArcs[i] = rightOut;
+        _strandArcs[i + 1] = leftOut;
+    }
+
+    // close the braid by identifying the outgoing arcs with the incoming ones
+    std::vector<uint16_t> closure(nextArc);
+    for (uint16_t arc = 0; arc < nextArc; arc++)
+        closure[arc] = arc;
+    for (uint16_t i = 0; i < strands; i++)
+        closure[_strandArcs[i]] = i + 1;
+
+    for (crossing &c : planarDiagram)
+    {
+        for (uint16_t &arc : c.arcs)
+            arc = closure[arc];
+    }
+
+    relabelPlanarDiagram(planarDiagram);
+    return planarDiagram;
+}
+
+/*
+    @brief Applies random Reidemeister I and II moves that add crossings to a diagram.
+    @param base A consistent planar diagram, it is not modified.
+    @param moves Number of moves to apply, each adds one (I) or two (II) crossings.
+    ! throws InconsistentPlanarDiagram if @p base fails the checks of the Knot constructor.
+    A move II pushes the outgoing over arc of a random crossing across its outgoing under
+    arc, these two arcs always share a face so the result stays planar.
+*/
+std::vector<crossing> DiagramGenerator::inflate(const std::vector<crossing> &base, size_t moves)
+{
+    if (base.size() > MAX_CROSSINGS || moves > (MAX_CROSSINGS - base.size()) / 2)
+        throw kle::DiagramGenerationException("a diagram can't have more than " + std::to_string(MAX_CROSSINGS) + " crossings.");
+    if (!isConsistentPlanarDiagram(base))
+        throw kle::InconsistentPlanarDiagram("arcs must be labeled 1 to 2n, enter and leave exactly one crossing each and form a single component.");
+
+    std::vector<crossing> planarDiagram(base);
+    planarDiagram.reserve(base.size() + 2 * moves);
+
+    uint16_t arcCount = 2 * base.size();
+    _arcHeads.assign(2 * (base.size() + 2 * moves) + 1, UINT32_MAX);
+    for (size_t i = 0; i < planarDiagram.size(); i++)
+    {
+        _arcHeads[planarDiagram[i].over_in()] = 4 * i;
+        _arcHeads[planarDiagram[i].under_in()] = 4 * i + 3;
+    }
+
+    for (size_t m = 0; m < moves; m++)
+    {
+        const uint32_t index = planarDiagram.size();
+
+        if (planarDiagram.empty())
+        {
+            planarDiagram.emplace_back(1, 1, 2, 2, uniform(2) == 0);
+            _arcHeads[1] = 0;
+            _arcHeads[2] = 3;
+            arcCount = 2;
+        }
+        else if (uniform(2) == 0)
+        {
+            // Reidemeister I: a kink on a random arc
+            const uint16_t arc = 1 + uniform(arcCount);
+            const uint16_t loop = arcCount + 1, exit = arcCount + 2;
+            const uint32_t head = _arcHeads[arc];
+
+            planarDiagram[head / 4].arcs[head % 4] = exit;
+            _arcHeads[exit] = head;
+
+            const bool sign = uniform(2) == 0;
+            if (uniform(2) == 0)
+            {
+                planarDiagram.emplace_back(arc, exit, loop, loop, sign);
+                _arcHeads[arc] = 4 * index;
+                _arcHeads[loop] = 4 * index + 3;
+            }
+            else
+            {
+                planarDiagram.emplace_back(loop, loop, exit, arc, sign);
+                _arcHeads[loop] = 4 * index;
+                _arcHeads[arc] = 4 * index + 3;
+            }
+            arcCount += 2;
+        }
+        else
+        {
+            // Reidemeister II: the over arc leaving a crossing makes a finger over the under arc
+            const crossing &x = planarDiagram[uniform(planarDiagram.size())];
+            const uint16_t over = x.over_out(), under = x.under_out();
+            const bool sign = !x.sign;
+            const uint16_t overMiddle = arcCount + 1, overExit = arcCount + 2;
+            const uint16_t underMiddle = arcCount + 3, underExit = arcCount + 4;
+
+            const uint32_t overHead = _arcHeads[over], underHead = _arcHeads[under];
+            planarDiagram[overHead / 4].arcs[overHead % 4] = overExit;
+            planarDiagram[underHead / 4].arcs[underHead % 4] = underExit;
+            _arcHeads[overExit] = overHead;
+            _arcHeads[underExit] = underHead;
+
+            planarDiagram.emplace_back(over, underMiddle, overMiddle, under, sign);
+            planarDiagram.emplace_back(overMiddle, underExit, overExit, underMiddle, !sign);
+            _arcHeads[over] = 4 * index;
+            _arcHeads[under] = 4 * index + 3;
+            _arcHeads[overMiddle] = 4 * (index + 1);
+            _arcHeads[underMiddle] = 4 * (index + 1) + 3;
+            arcCount += 4;
+        }
+    }
+
+    relabelPlanarDiagram(planarDiagram);
+    return planarDiagram;
+}
+
+/*
+    @brief Connected sum of two diagrams, cut and reglued at a random arc of each.
+    @param left A consistent planar diagram.
+    @param right A consistent planar diagram.
+    ! throws InconsistentPlanarDiagram if a summand fails the checks of the Knot constructor.
+*/
+std::vector<crossing> DiagramGenerator::connectedSum(const std::vector<crossing> &left, const std::vector<crossing> &right)
+{
+    if (!isConsistentPlanarDiagram(left) || !isConsistentPlanarDiagram(right))
+        throw kle::InconsistentPlanarDiagram("arcs must be labeled 1 to 2n, enter and leave exactly one crossing each and form a single component.");
+    if (left.empty())
+        return right;
+    if (right.empty())
+        return left;
+    // the right labels are shifted past the left ones and must stay below UINT16_MAX
+    if (left.size() > MAX_CROSSINGS || right.size() > MAX_CROSSINGS - left.size())
+        throw kle::DiagramGenerationException("a diagram can't have more than " + std::to_string(MAX_CROSSINGS) + " crossings.");
+
+    const uint16_t offset = 2 * left.size();
+    const uint16_t leftArc = 1 + uniform(2 * left.size());
+    const uint16_t rightArc = offset + 1 + uniform(2 * right.size());
+
+    std::vector<crossing> planarDiagram(left);
+    planarDiagram.reserve(left.size() + right.size());
+    for (crossing c : right)
+    {
+        for (uint16_t &arc : c.arcs)
+            arc += offset;
+        planarDiagram.push_back(c);
+    }
+
+    // swap the heads of the two cut arcs
+    for (size_t i = 0; i < planarDiagram.size(); i++)
+    {
+        crossing &c = planarDiagram[i];
+        const uint16_t cut = (i < left.size()) ? leftArc : rightArc;
+        const uint16_t glued = (i < left.size()) ? rightArc : leftArc;
+
+        if (c.arcs[0] == cut)
+            c.arcs[0] = glued;
+        else if (c.arcs[3] == cut)
+            c.arcs[3] = glued;
+    }
+
+    relabelPlanarDiagram(planarDiagram);
+    return planarDiagram;
+}
+
+/*
+    @brief Connected sum of several random braid closures.
+    @param summands Number of knots to add together.
+    @param strands Number of strands of every braid.
+    @param length Number of generators of every braid word.
+*/
+std::vector<crossing> DiagramGenerator::connectedSum(size_t summands, uint16_t strands, size_t length)
+{
+    std::vector<crossing> planarDiagram;
+    for (size_t i = 0; i < summands; i++)
+        planarDiagram = connectedSum(planarDiagram, braidClosure(strands, length));
+
+    return planarDiagram;
+}
+
+/*
+    @brief Draws an integer uniformly in [0, bound) with Lemire's multiply-shift method.
+    std::uniform_int_distribution is not used because its output differs between standard libraries.
+*/
+uint64_t DiagramGenerator::uniform(uint64_t bound)
+{
+    __uint128_t product = (__uint128_t)_engine() * bound;
+    uint64_t low = (uint64_t)product;
+
+    if (low < bound)
+    {
+        const uint64_t threshold = -bound % bound;
+        while (low < threshold)
+        {
+            product = (__uint128_t)_engine() * bound;
+            low = (uint64_t)product;
+        }
+    }
+    return product >> 64;
+}
+
+uint16_t DiagramGenerator::findStrand(uint16_t strand)
+{
+    while (_strandRoots[strand] != strand)
+    {
+        _strandRoots[strand] = _strandRoots[_strandRoots[strand]];
+        strand = _strandRoots[strand];
+    }
+    return strand;
+}
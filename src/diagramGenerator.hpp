@@ -0,0 +1,36 @@
+#pragma once
+
+#include "knot.hpp"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/**
+ * @class DiagramGenerator
+ * @brief Seeded source of random planar diagrams for scaling and stress workloads.
+ *
+ * Every diagram returned is consistent (arcs labeled 1..2n along the orientation)
+ * and planar, so it can be handed straight to Knot. The same seed always yields the
+ * same sequence of diagrams, independently of the standard library in use.
+ */
+class DiagramGenerator
+{
+public:
+    explicit DiagramGenerator(uint64_t seed);
+
+    std::vector<crossing> braidClosure(uint16_t strands, size_t length);
+    std::vector<crossing> inflate(const std::vector<crossing> &base, size_t moves);
+    std::vector<crossing> connectedSum(const std::vector<crossing> &left, const std::vector<crossing> &right);
+    std::vector<crossing> connectedSum(size_t summands, uint16_t strands, size_t length);
+
+private:
+    std::mt19937_64 _engine;
+
+    // scratch buffers reused between calls to avoid reallocating for every diagram
+    std::vector<uint16_t> _strandArcs;
+    std::vector<uint16_t> _strandRoots;
+    std::vector<uint32_t> _arcHeads;
+
+    uint64_t uniform(uint64_t bound);
+    uint16_t findStrand(uint16_t strand);
+};
@@ -0,0 +1,513 @@
+#include "enumerator.hpp"
+#include "exception.hpp"
+#include "gaussDiagram.hpp"
+#include <atomic>
+#include <bit>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+// masks of chords and of used labels are stored on 64 bits
+static constexpr uint16_t MAX_CROSSINGS = 32;
+static constexpr size_t SPLIT_DEPTH = 3;
+
+/*
+    @brief True when an arc of the circle, other than a single passage or the circle minus
+    one, holds both ends of every chord that starts in it. Such an arc is a nugatory crossing
+    or a summand of a connected sum.
+*/
+static bool hasClosedArc(const std::vector<int16_t> &partner)
+{
+    const int32_t length = partner.size();
+    for (int32_t start = 0; start < length; start++)
+    {
+        int32_t reach = 0;
+        for (int32_t arc = 1; arc <= length - 2; arc++)
+        {
+            const int32_t position = (start + arc - 1) % length;
+            reach = std::max(reach, (partner[position] - start + length) % length);
+            if (arc >= 2 && reach < arc)
+                return true;
+        }
+    }
+    return false;
+}
+
+/*
+    @brief Finds, for every crossing, on which side the second passage crosses the first.
+    @param direction Set to 1 when, counterclockwise from the first incoming arc, the next
+    arc is the second incoming one.
+    @return False when the code can't be drawn in the plane (Gauss parity fails or the
+    interlacement graph is disconnected or inconsistent).
+    Two interlaced chords a and b, first met at positions a1 and b1, satisfy
+    direction[a] ^ direction[b] = 1 ^ (b1 - a1) ^ |chords interlaced with both|, mod 2.
+    The first direction is fixed, the other solution is the mirror drawing.
+*/
+static bool crossingDirections(const std::vector<int16_t> &partner, std::vector<uint8_t> &direction)
+{
+    const size_t chords = partner.size() / 2;
+    std::vector<uint64_t> interlaced(chords, 0);
+
+    for (size_t a = 0; a < chords; a++)
+    {
+        const int32_t low = std::min<int32_t>(2 * a, partner[2 * a]), high = std::max<int32_t>(2 * a, partner[2 * a]);
+        for (size_t b = 0; b < chords; b++)
+        {
+            const bool firstInside = low < (int32_t)(2 * b) && (int32_t)(2 * b) < high;
+            const bool secondInside = low < partner[2 * b] && partner[2 * b] < high;
+            if (a != b && firstInside != secondInside)
+                interlaced[a] |= uint64_t(1) << b;
+        }
+        if (std::popcount(interlaced[a]) % 2 != 0)
+            return false;
+    }
+
+    direction.assign(chords, 2);
+    direction[0] = 0;
+    std::vector<size_t> stack{0};
+    while (!stack.empty())
+    {
+        const size_t a = stack.back();
+        stack.pop_back();
+
+        for (uint64_t neighbours = interlaced[a]; neighbours != 0; neighbours &= neighbours - 1)
+        {
+            const size_t b = std::countr_zero(neighbours);
+            const int32_t firstA = std::min<int32_t>(2 * a, partner[2 * a]), firstB = std::min<int32_t>(2 * b, partner[2 * b]);
+            const uint8_t expected = direction[a] ^ 1 ^ (std::abs(firstB - firstA) & 1) ^ (std::popcount(interlaced[a] & interlaced[b]) & 1);
+
+            if (direction[b] == 2)
+            {
+                direction[b] = expected;
+                stack.push_back(b);
+            }
+            else if (direction[b] != expected)
+                return false;
+        }
+    }
+
+    for (uint8_t d : direction)
+    {
+        if (d == 2)
+            return false;
+    }
+    return true;
+}
+
+/*
+    @brief Planar diagram of a realizable code.
+    @param overMask Bit i is set when the knot passes over crossing i at the odd label 2i + 1.
+*/
+static std::vector<crossing> buildPlanarDiagram(const std::vector<int16_t> &partner, const std::vector<uint8_t> &direction, uint64_t overMask)
+{
+    const uint16_t length = partner.size();
+    std::vector<crossing> planarDiagram(length / 2, crossing(0, 0, 0, 0));
+
+    for (uint16_t position = 0; position < length; position++)
+    {
+        const bool odd = position % 2 == 0; // labels start at 1
+        const size_t chord = (odd ? position : partner[position]) / 2;
+        const bool isOver = ((overMask >> chord) & 1) == odd;
+        const uint16_t in = position + 1, out = (position + 1) % length + 1;
+
+        if (isOver)
+        {
+            planarDiagram[chord].arcs[0] = in;
+            planarDiagram[chord].arcs[2] = out;
+        }
+        else
+        {
+            planarDiagram[chord].arcs[3] = in;
+            planarDiagram[chord].arcs[1] = out;
+        }
+    }
+
+    for (size_t chord = 0; chord < planarDiagram.size(); chord++)
+    {
+        const bool firstIsOdd = (int16_t)(2 * chord) < partner[2 * chord];
+        const bool firstIsOver = ((overMask >> chord) & 1) == firstIsOdd;
+        planarDiagram[chord].sign = (direction[chord] == 1) == firstIsOver;
+    }
+
+    return planarDiagram;
+}
+
+void DiagramBucket::merge(const DiagramBucket &other)
+{
+    if (other.count == 0)
+        return;
+
+    if (count == 0 || std::tie(other.dtCode, other.overMask) < std::tie(dtCode, overMask))
+    {
+        dtCode = other.dtCode;
+        overMask = other.overMask;
+    }
+    count += other.count;
+}
+
+/*
+    @brief Prepares the enumeration of the diagrams with @p crossings crossings.
+    @param alternatingOnly Only keep the alternating diagram of every shadow.
+*/
+KnotEnumerator::KnotEnumerator(uint16_t crossings, bool alternatingOnly)
+    : _crossings(crossings), _alternatingOnly(alternatingOnly), _splitDepth(std::min<size_t>(crossings, SPLIT_DEPTH)),
+      _shadowCount(0), _diagramCount(0)
+{
+    if (crossings < 3 || crossings > MAX_CROSSINGS)
+        throw kle::DiagramGenerationException("prime diagrams can only be enumerated from 3 to " + std::to_string(MAX_CROSSINGS) + " crossings.");
+}
+
+/*
+    @brief Runs (or resumes) the enumeration.
+    @param checkpointPath File recording the finished subtrees, no checkpoint when empty.
+    If the file exists it must come from an enumeration with the same parameters, its
+    finished subtrees are loaded instead of being searched again.
+    @param threadCount Number of worker threads.
+*/
+void KnotEnumerator::run(const std::string &checkpointPath, unsigned threadCount)
+{
+    _frontier.clear();
+    _buckets.clear();
+    _shadowCount = 0;
+    _diagramCount = 0;
+
+    std::vector<int16_t> partner(2 * _crossings, -1);
+    std::vector<uint16_t> code;
+    buildFrontier(partner, code, 0);
+    _finished.assign(_frontier.size(), false);
+
+    if (!checkpointPath.empty())
+    {
+        if (std::ifstream(checkpointPath).good())
+            loadCheckpoint(checkpointPath);
+        else
+        {
+            std::ofstream file(checkpointPath);
+            file << "knotlib-enumeration " << _crossings << " " << _alternatingOnly << " " << _splitDepth << " " << _frontier.size() << "\n";
+            for (const std::vector<uint16_t> &prefix : _frontier)
+            {
+                file << prefix.size();
+                for (uint16_t label : prefix)
+                    file << " " << label;
+                file << "\n";
+            }
+        }
+    }
+
+    std::vector<size_t> pending;
+    for (size_t task = 0; task < _frontier.size(); task++)
+    {
+        if (!_finished[task])
+            pending.push_back(task);
+    }
+
+    std::atomic<size_t> next{0};
+    auto worker = [&]()
+    {
+        for (size_t k = next++; k < pending.size(); k = next++)
+        {
+            const size_t task = pending[k];
+            std::vector<int16_t> taskPartner(2 * _crossings, -1);
+            std::vector<uint16_t> taskCode = _frontier[task];
+            uint64_t usedEvens = 0;
+            for (size_t i = 0; i < taskCode.size(); i++)
+            {
+                taskPartner[2 * i] = taskCode[i] - 1;
+                taskPartner[taskCode[i] - 1] = 2 * i;
+                usedEvens |= uint64_t(1) << (taskCode[i] / 2 - 1);
+            }
+
+            TaskResult result;
+            expand(taskPartner, taskCode, usedEvens, result);
+
+            std::lock_guard<std::mutex> lock(_resultMutex);
+            _shadowCount += result.shadows;
+            _diagramCount += result.diagrams;
+            for (const auto &[key, bucket] : result.buckets)
+                _buckets[key].merge(bucket);
+            _finished[task] = true;
+            if (!checkpointPath.empty())
+                saveTask(checkpointPath, task, result);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < std::max(1u, threadCount); i++)
+        threads.emplace_back(worker);
+    worker();
+    for (std::thread &thread : threads)
+        thread.join();
+}
+
+// Read only
+const std::map<InvariantKey, DiagramBucket> &KnotEnumerator::getBuckets() const { return _buckets; }
+uint64_t KnotEnumerator::getShadowCount() const { return _shadowCount; }
+uint64_t KnotEnumerator::getDiagramCount() const { return _diagramCount; }
+
+/*
+    @brief Planar diagram of a DT code.
+    @param dtCode Even label paired with each odd label 1, 3, 5, ...
+    @param overMask Bit i is set when the knot passes over at the odd label 2i + 1.
+    @throws InconsistentPlanarDiagram if the code can't be drawn in the plane.
+*/
+std::vector<crossing> KnotEnumerator::planarDiagram(const std::vector<uint16_t> &dtCode, uint64_t overMask)
+{
+    std::vector<int16_t> partner(2 * dtCode.size(), -1);
+    for (size_t i = 0; i < dtCode.size(); i++)
+    {
+        if (dtCode[i] == 0 || dtCode[i] % 2 != 0 || dtCode[i] > partner.size() || partner[dtCode[i] - 1] != -1)
+            throw kle::InconsistentPlanarDiagram("a DT code must pair every odd label with a distinct even label.");
+        partner[2 * i] = dtCode[i] - 1;
+        partner[dtCode[i] - 1] = 2 * i;
+    }
+
+    std::vector<uint8_t> direction;
+    std::vector<crossing> diagram;
+    if (!dtCode.empty() && crossingDirections(partner, direction))
+        diagram = buildPlanarDiagram(partner, direction, overMask);
+
+    if (!dtCode.empty() && (diagram.empty() || !Knot(diagram).isPlanar()))
+        throw kle::InconsistentPlanarDiagram("the DT code is not realizable in the plane.");
+
+    return diagram;
+}
+
+void KnotEnumerator::buildFrontier(std::vector<int16_t> &partner, std::vector<uint16_t> &code, uint64_t usedEvens)
+{
+    if (code.size() == _splitDepth)
+    {
+        _frontier.push_back(code);
+        return;
+    }
+
+    const int16_t odd = 2 * code.size();
+    for (uint16_t even = 2; even <= 2 * _crossings; even += 2)
+    {
+        const int16_t position = even - 1;
+        if ((usedEvens >> (even / 2 - 1)) & 1 || std::abs(position - odd) == 1 || (odd == 0 && position == 2 * _crossings - 1))
+            continue;
+
+        partner[odd] = position;
+        partner[position] = odd;
+        code.push_back(even);
+        if (isMinimalPrefix(partner, code, nullptr))
+            buildFrontier(partner, code, usedEvens | (uint64_t(1) << (even / 2 - 1)));
+        code.pop_back();
+        partner[odd] = -1;
+        partner[position] = -1;
+    }
+}
+
+/*
+    @brief Depth first search below a partial code, a kink (partner at a neighbouring
+    label) is never chosen.
+*/
+void KnotEnumerator::expand(std::vector<int16_t> &partner, std::vector<uint16_t> &code, uint64_t usedEvens, TaskResult &result) const
+{
+    if (code.size() == _crossings)
+    {
+        processShadow(partner, code, result);
+        return;
+    }
+
+    const int16_t odd = 2 * code.size();
+    for (uint16_t even = 2; even <= 2 * _crossings; even += 2)
+    {
+        const int16_t position = even - 1;
+        if ((usedEvens >> (even / 2 - 1)) & 1 || std::abs(position - odd) == 1 || (odd == 0 && position == 2 * _crossings - 1))
+            continue;
+
+        partner[odd] = position;
+        partner[position] = odd;
+        code.push_back(even);
+        if (isMinimalPrefix(partner, code, nullptr))
+            expand(partner, code, usedEvens | (uint64_t(1) << (even / 2 - 1)), result);
+        code.pop_back();
+        partner[odd] = -1;
+        partner[position] = -1;
+    }
+}
+
+/*
+    @brief Buckets every over/under pattern of a complete minimal code.
+    Patterns are taken up to the automorphisms of the code and to mirror image (the
+    complement mask), only the smallest mask of each orbit is kept.
+*/
+void KnotEnumerator::processShadow(const std::vector<int16_t> &partner, const std::vector<uint16_t> &code, TaskResult &result) const
+{
+    std::vector<std::vector<uint16_t>> automorphisms;
+    std::vector<uint8_t> direction;
+    if (!isMinimalPrefix(partner, code, &automorphisms) || hasClosedArc(partner) || !crossingDirections(partner, direction))
+        return;
+
+    const uint64_t full = (_crossings == 64) ? ~uint64_t(0) : (uint64_t(1) << _crossings) - 1;
+    if (!Knot(buildPlanarDiagram(partner, direction, full)).isPlanar())
+        return;
+    result.shadows++;
+
+    const uint64_t lastMask = _alternatingOnly ? full : (full >> 1); // the top bit is fixed by the mirror
+    for (uint64_t mask = _alternatingOnly ? full : 0; mask <= lastMask; mask++)
+    {
+        bool smallest = true;
+        for (size_t a = 0; a < automorphisms.size() && smallest && !_alternatingOnly; a++)
+        {
+            uint64_t image = 0;
+            for (size_t chord = 0; chord < _crossings; chord++)
+                image |= (((mask >> chord) & 1) ^ (automorphisms[a][chord] & 1)) << (automorphisms[a][chord] >> 1);
+            smallest = mask <= image && mask <= (image ^ full);
+        }
+        if (!smallest)
+            continue;
+
+        const Knot knot(buildPlanarDiagram(partner, direction, mask));
+        const GaussDiagram gauss(knot);
+        const InvariantKey key{_crossings, knot.determinant(), gauss.v2(), std::abs(gauss.v3())};
+
+        result.diagrams++;
+        result.buckets[key].merge(DiagramBucket{1, code, mask});
+    }
+}
+
+/*
+    @brief Compares the known prefix of the code with the codes read from every other base
+    point and direction.
+    @param automorphisms When not null and the code is complete, receives the relabelings
+    that give back the same code, as newChord * 2 + (1 if the odd label moved to an even one).
+    @return False when another relabeling gives a smaller prefix.
+*/
+bool KnotEnumerator::isMinimalPrefix(const std::vector<int16_t> &partner, const std::vector<uint16_t> &code,
+                                     std::vector<std::vector<uint16_t>> *automorphisms) const
+{
+    const int32_t length = partner.size();
+
+    for (int32_t start = 0; start < length; start++)
+    {
+        for (int32_t step : {1, -1})
+        {
+            if (start == 0 && step == 1)
+                continue;
+
+            // position p becomes step * (p - start), new odd label 2j + 1 was at start + step * 2j
+            bool equal = true;
+            for (size_t j = 0; j < code.size(); j++)
+            {
+                const int32_t old = ((start + step * 2 * (int32_t)j) % length + length) % length;
+                if (partner[old] < 0)
+                {
+                    equal = false;
+                    break;
+                }
+
+                const uint16_t relabeled = ((step * (partner[old] - start)) % length + length) % length + 1;
+                if (relabeled < code[j])
+                    return false;
+                if (relabeled > code[j])
+                {
+                    equal = false;
+                    break;
+                }
+            }
+
+            if (equal && automorphisms != nullptr && code.size() == _crossings)
+            {
+                std::vector<uint16_t> image(_crossings);
+                for (size_t chord = 0; chord < _crossings; chord++)
+                {
+                    const int32_t moved = ((step * ((int32_t)(2 * chord) - start)) % length + length) % length;
+                    if (moved % 2 == 0)
+                        image[chord] = moved;
+                    else
+                        image[chord] = ((step * (partner[2 * chord] - start)) % length + length) % length + 1;
+                }
+                automorphisms->push_back(image);
+            }
+        }
+    }
+    return true;
+}
+
+void KnotEnumerator::loadCheckpoint(const std::string &checkpointPath)
+{
+    std::ifstream file(checkpointPath);
+    std::string line, magic;
+    size_t crossings, alternatingOnly, splitDepth, frontierSize;
+
+    std::getline(file, line);
+    std::istringstream header(line);
+    if (!(header >> magic >> crossings >> alternatingOnly >> splitDepth >> frontierSize) || magic != "knotlib-enumeration")
+        throw kle::CheckpointException(checkpointPath + " is not an enumeration checkpoint.");
+    if (crossings != _crossings || alternatingOnly != _alternatingOnly || splitDepth != _splitDepth || frontierSize != _frontier.size())
+        throw kle::CheckpointException(checkpointPath + " was written by an enumeration with other parameters.");
+
+    for (size_t task = 0; task < frontierSize; task++)
+    {
+        std::getline(file, line);
+        std::istringstream prefix(line);
+        size_t size;
+        std::vector<uint16_t> code;
+        prefix >> size;
+        for (uint16_t label; prefix >> label;)
+            code.push_back(label);
+        if (code.size() != size || code != _frontier[task])
+            throw kle::CheckpointException(checkpointPath + " has a different search frontier.");
+    }
+
+    // blocks "task <i> <shadows> <diagrams>", bucket lines, "end <i>", an unfinished block is dropped
+    TaskResult block;
+    size_t blockTask = SIZE_MAX;
+    while (std::getline(file, line))
+    {
+        std::istringstream fields(line);
+        std::string word;
+        fields >> word;
+
+        if (word == "task")
+        {
+            block = TaskResult();
+            fields >> blockTask >> block.shadows >> block.diagrams;
+        }
+        else if (word == "end")
+        {
+            size_t task;
+            fields >> task;
+            if (task != blockTask || task >= _finished.size())
+                continue;
+
+            _finished[task] = true;
+            _shadowCount += block.shadows;
+            _diagramCount += block.diagrams;
+            for (const auto &[key, bucket] : block.buckets)
+                _buckets[key].merge(bucket);
+            blockTask = SIZE_MAX;
+        }
+        else if (blockTask != SIZE_MAX)
+        {
+            InvariantKey key;
+            DiagramBucket bucket;
+            std::istringstream entry(line);
+            entry >> key.crossings >> key.determinant >> key.v2 >> key.v3 >> bucket.count >> bucket.overMask;
+            for (uint16_t label; entry >> label;)
+                bucket.dtCode.push_back(label);
+            if (bucket.dtCode.size() == _crossings)
+                block.buckets[key].merge(bucket);
+        }
+    }
+}
+
+void KnotEnumerator::saveTask(const std::string &checkpointPath, size_t task, const TaskResult &result)
+{
+    std::ostringstream block;
+    block << "task " << task << " " << result.shadows << " " << result.diagrams << "\n";
+    for (const auto &[key, bucket] : result.buckets)
+    {
+        block << key.crossings << " " << key.determinant << " " << key.v2 << " " << key.v3 << " " << bucket.count << " " << bucket.overMask;
+        for (uint16_t label : bucket.dtCode)
+            block << " " << label;
+        block << "\n";
+    }
+    block << "end " << task << "\n";
+
+    std::ofstream file(checkpointPath, std::ios::app);
+    file << block.str();
+    file.flush();
+}
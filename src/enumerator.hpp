@@ -0,0 +1,95 @@
+#pragma once
+
+#include "knot.hpp"
+#include <compare>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Invariants used to group the enumerated diagrams, candidates in different buckets
+ *        are different knots. |v3| is used so a knot and its mirror share a bucket.
+ */
+struct InvariantKey
+{
+    uint16_t crossings;
+    uint64_t determinant;
+    int64_t v2;
+    int64_t v3;
+
+    auto operator<=>(const InvariantKey &) const = default;
+};
+
+/**
+ * @brief Number of diagrams in a bucket and the smallest of them (by DT code, then over mask).
+ */
+struct DiagramBucket
+{
+    uint64_t count = 0;
+    std::vector<uint16_t> dtCode;
+    uint64_t overMask = 0;
+
+    void merge(const DiagramBucket &other);
+};
+
+/**
+ * @class KnotEnumerator
+ * @brief Enumerates the prime, reduced knot diagrams with a given number of crossings.
+ *
+ * Diagrams are built one crossing at a time as Dowker-Thistlethwaite codes: the partner
+ * of the odd labels 1, 3, 5, ... is chosen in order among the unused even labels.
+ * - Orderly generation: a partial code is dropped as soon as relabeling the knot from
+ *   another base point or in the other direction gives a smaller known prefix, so every
+ *   shadow is produced once, by its minimal code.
+ * - Codes with a proper arc closed under the pairing (nugatory crossing or connected sum)
+ *   are rejected, as are the codes that can't be drawn in the plane.
+ * - Every over/under pattern (or only the alternating one) up to the symmetries of the
+ *   shadow and mirror image is turned into a Knot and bucketed by determinant, v2 and |v3|.
+ *
+ * The search tree is cut at a fixed depth and the subtrees are shared between threads.
+ * Finished subtrees are appended to a checkpoint file so an interrupted run resumes
+ * where it stopped.
+ */
+class KnotEnumerator
+{
+public:
+    KnotEnumerator(uint16_t crossings, bool alternatingOnly = true);
+
+    void run(const std::string &checkpointPath = "", unsigned threadCount = std::thread::hardware_concurrency());
+
+    // read only
+    const std::map<InvariantKey, DiagramBucket> &getBuckets() const;
+    uint64_t getShadowCount() const;
+    uint64_t getDiagramCount() const;
+
+    static std::vector<crossing> planarDiagram(const std::vector<uint16_t> &dtCode, uint64_t overMask);
+
+private:
+    struct TaskResult
+    {
+        uint64_t shadows = 0;
+        uint64_t diagrams = 0;
+        std::map<InvariantKey, DiagramBucket> buckets;
+    };
+
+    uint16_t _crossings;
+    bool _alternatingOnly;
+    size_t _splitDepth;
+
+    std::vector<std::vector<uint16_t>> _frontier;
+    std::vector<bool> _finished;
+    std::map<InvariantKey, DiagramBucket> _buckets;
+    uint64_t _shadowCount, _diagramCount;
+    std::mutex _resultMutex;
+
+    void buildFrontier(std::vector<int16_t> &partner, std::vector<uint16_t> &code, uint64_t usedEvens);
+    void expand(std::vector<int16_t> &partner, std::vector<uint16_t> &code, uint64_t usedEvens, TaskResult &result) const;
+    void processShadow(const std::vector<int16_t> &partner, const std::vector<uint16_t> &code, TaskResult &result) const;
+    bool isMinimalPrefix(const std::vector<int16_t> &partner, const std::vector<uint16_t> &code, std::vector<std::vector<uint16_t>> *automorphisms) const;
+
+    void loadCheckpoint(const std::string &checkpointPath);
+    void saveTask(const std::string &checkpointPath, size_t task, const TaskResult &result);
+};
@@ -74,4 +74,49 @@ class PolynomialRepresentationException : public KnotlibExceptions
 public:
     PolynomialRepresentationException(const std::string& msg) : KnotlibExceptions(msg) {}
 };
+
+/**
+ * Thrown when a random planar diagram cannot be generated with the requested parameters.
+ * */
+class DiagramGenerationException : public KnotlibExceptions
+{
+public:
+    DiagramGenerationException(const std::string& msg) : KnotlibExceptions(msg) {}
+};
+
+/**
+ * Thrown when a presentation matrix can't be factored.
+ * */
+class SingularPresentationMatrix : public KnotlibExceptions
+{
+public:
+    SingularPresentationMatrix(const std::string& msg) : KnotlibExceptions(msg) {}
+};
+
+/**
+ * Thrown when an exact invariant doesn't fit in the integer type that holds it.
+ * */
+class InvariantOverflowException : public KnotlibExceptions
+{
+public:
+    InvariantOverflowException(const std::string& msg) : KnotlibExceptions(msg) {}
+};
+
+/**
+ * Thrown when an enumeration checkpoint can't be read or doesn't match the enumeration.
+ * */
+class CheckpointException : public KnotlibExceptions
+{
+public:
+    CheckpointException(const std::string& msg) : KnotlibExceptions(msg) {}
+};
+
+/**
+ * Thrown when a line of a planar diagram file can't be parsed.
+ * */
+class MalformedRecordException : public KnotlibExceptions
+{
+public:
+    MalformedRecordException(const std::string& msg) : KnotlibExceptions(msg) {}
+};
 }
@@ -0,0 +1,182 @@
+#pragma once
+
+#include "Polynomials.hpp"
+#include <cstddef>
+#include <initializer_list>
+
+/**
+ * @brief Fixed-capacity, constexpr counterpart of Polynomial.
+ *
+ * Coefficients of the Laurent polynomial are stored densely from the trailing degree up,
+ * in an array of @p Capacity doubles, so values can be built, added, multiplied and
+ * compared at compile time (reference tables, static_assert) and converted to a
+ * Polynomial at run time. Zero coefficients at both ends are trimmed after every
+ * operation, two equal polynomials therefore have the same representation.
+ *
+ * @tparam Capacity Maximum number of coefficients between the trailing and leading degree.
+ * An operation whose result doesn't fit throws PolynomialBoundException (a compile error
+ * in a constant expression).
+ */
+template <size_t Capacity>
+class FixedPolynomial
+{
+public:
+    constexpr FixedPolynomial() : _coefficients{}, _trailingDegree(0), _size(0) {}
+
+    /*
+        @param coefficients Coefficients from @p trailingDegree up.
+        @param trailingDegree Degree of the first coefficient.
+    */
+    constexpr FixedPolynomial(std::initializer_list<double> coefficients, DEGREE_TYPE trailingDegree = 0)
+        : _coefficients{}, _trailingDegree(trailingDegree), _size(coefficients.size())
+    {
+        if (coefficients.size() > Capacity)
+            throw kle::PolynomialBoundException("too many coefficients for a FixedPolynomial.");
+
+        size_t i = 0;
+        for (double coefficient : coefficients)
+            _coefficients[i++] = coefficient;
+        trim();
+    }
+
+    constexpr bool operator==(const FixedPolynomial &n) const
+    {
+        if (_size != n._size || (_size != 0 && _trailingDegree != n._trailingDegree))
+            return false;
+        for (size_t i = 0; i < _size; i++)
+        {
+            if (_coefficients[i] != n._coefficients[i])
+                return false;
+        }
+        return true;
+    }
+
+    constexpr bool operator!=(const FixedPolynomial &n) const { return !(*this == n); }
+
+    constexpr FixedPolynomial operator+(const FixedPolynomial &n) const { return combine(n, 1); }
+    constexpr FixedPolynomial operator-(const FixedPolynomial &n) const { return combine(n, -1); }
+
+    constexpr FixedPolynomial operator*(const FixedPolynomial &n) const
+    {
+        FixedPolynomial product;
+        if (isZero() || n.isZero())
+            return product;
+        if (_size + n._size - 1 > Capacity)
+            throw kle::PolynomialBoundException("the product doesn't fit in the FixedPolynomial capacity.");
+
+        product._trailingDegree = _trailingDegree + n._trailingDegree;
+        product._size = _size + n._size - 1;
+        for (size_t i = 0; i < _size; i++)
+        {
+            for (size_t j = 0; j < n._size; j++)
+                product._coefficients[i + j] += _coefficients[i] * n._coefficients[j];
+        }
+        product.trim();
+        return product;
+    }
+
+    constexpr FixedPolynomial operator*(const double scalar) const
+    {
+        FixedPolynomial scaled(*this);
+        for (size_t i = 0; i < _size; i++)
+            scaled._coefficients[i] *= scalar;
+        scaled.trim();
+        return scaled;
+    }
+
+    constexpr void operator+=(const FixedPolynomial &n) { *this = *this + n; }
+    constexpr void operator-=(const FixedPolynomial &n) { *this = *this - n; }
+    constexpr void operator*=(const FixedPolynomial &n) { *this = *this * n; }
+
+    /*
+        @brief Value at @p t (Horner scheme from the leading coefficient).
+        @p t must not be 0 when the trailing degree is negative.
+    */
+    constexpr double evaluate(double t) const
+    {
+        double value = 0;
+        for (size_t i = _size; i-- > 0;)
+            value = value * t + _coefficients[i];
+
+        for (DEGREE_TYPE d = 0; d < _trailingDegree; d++)
+            value *= t;
+        for (DEGREE_TYPE d = 0; d > _trailingDegree; d--)
+            value /= t;
+        return value;
+    }
+
+    // read only
+    constexpr bool isZero() const { return _size == 0; }
+    constexpr size_t size() const { return _size; }
+    constexpr DEGREE_TYPE getTrailingDegree() const { return _trailingDegree; }
+    constexpr DEGREE_TYPE getLeadingDegree() const { return _trailingDegree + (DEGREE_TYPE)_size - 1; }
+
+    constexpr double getCoefficient(DEGREE_TYPE degree) const
+    {
+        if (_size == 0 || degree < _trailingDegree || degree > getLeadingDegree())
+            return 0;
+        return _coefficients[degree - _trailingDegree];
+    }
+
+    /*
+        @brief Dense Polynomial with the same terms (the zero polynomial is 0x^0).
+    */
+    Polynomial toPolynomial() const
+    {
+        if (isZero())
+            return Polynomial(std::vector<Term>{Term{0, 0}}, 0, 0);
+
+        std::vector<Term> terms(_size);
+        for (size_t i = 0; i < _size; i++)
+            terms[i] = Term{_coefficients[i], (DEGREE_TYPE)(_trailingDegree + (DEGREE_TYPE)i)};
+        return Polynomial(terms, getTrailingDegree(), getLeadingDegree());
+    }
+
+private:
+    double _coefficients[Capacity];
+    DEGREE_TYPE _trailingDegree;
+    size_t _size;
+
+    constexpr FixedPolynomial combine(const FixedPolynomial &n, double factor) const
+    {
+        if (isZero())
+            return n * factor;
+        if (n.isZero())
+            return *this;
+
+        const DEGREE_TYPE trailing = (_trailingDegree < n._trailingDegree) ? _trailingDegree : n._trailingDegree;
+        const DEGREE_TYPE leading = (getLeadingDegree() > n.getLeadingDegree()) ? getLeadingDegree() : n.getLeadingDegree();
+        if ((size_t)(leading - trailing) + 1 > Capacity)
+            throw kle::PolynomialBoundException("the sum doesn't fit in the FixedPolynomial capacity.");
+
+        FixedPolynomial sum;
+        sum._trailingDegree = trailing;
+        sum._size = leading - trailing + 1;
+        for (DEGREE_TYPE degree = trailing; degree <= leading; degree++)
+            sum._coefficients[degree - trailing] = getCoefficient(degree) + factor * n.getCoefficient(degree);
+        sum.trim();
+        return sum;
+    }
+
+    // drops the zero coefficients at both ends
+    constexpr void trim()
+    {
+        while (_size > 0 && _coefficients[_size - 1] == 0)
+            _size--;
+        if (_size == 0)
+            _trailingDegree = 0;
+
+        size_t first = 0;
+        while (first < _size && _coefficients[first] == 0)
+            first++;
+        if (first == 0)
+            return;
+
+        for (size_t i = first; i < _size; i++)
+            _coefficients[i - first] = _coefficients[i];
+        for (size_t i = _size - first; i < _size; i++)
+            _coefficients[i] = 0;
+        _size -= first;
+        _trailingDegree += (DEGREE_TYPE)first;
+    }
+};
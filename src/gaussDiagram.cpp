@@ -0,0 +1,418 @@
+#include "gaussDiagram.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+/*
+    Fenwick tree of signed weights over positions 0..size-1.
+*/
+class FenwickTree
+{
+public:
+    explicit FenwickTree(size_t size) : _tree(size + 1, 0) {}
+
+    void add(size_t position, int64_t weight)
+    {
+        for (size_t i = position + 1; i < _tree.size(); i += i & (~i + 1))
+            _tree[i] += weight;
+    }
+
+    // sum of the weights at positions strictly smaller than end
+    int64_t prefix(size_t end) const
+    {
+        int64_t sum = 0;
+        for (size_t i = end; i > 0; i -= i & (~i + 1))
+            sum += _tree[i];
+        return sum;
+    }
+
+private:
+    std::vector<int64_t> _tree;
+};
+
+/*
+    Chords crossing a window of consecutive positions around the circle, kept up to date
+    while the window grows or shrinks by one position at either end.
+    A crossing chord has one end in the window and the other outside, where positions are
+    read from the end of the window on. Positions run over 0..2L-1, L the length of the
+    code, so that the window [first, last] and the positions outside it (last, first + L)
+    are increasing. It keeps, with e the signs:
+    - pairs: sum of e_a e_c over crossing chords a before c in the window, with a met over
+      and c met under there,
+    - orderedPairs: the same sum restricted to a before c outside the window too.
+    A chord entering or leaving at an end of the window is first or last on one side, so
+    its pairs are counted by one Fenwick tree query on the other side.
+*/
+class ArcWindow
+{
+public:
+    ArcWindow(const std::vector<uint32_t> &over, const std::vector<uint32_t> &under, const std::vector<int8_t> &sign, const std::vector<uint32_t> &chordAt)
+        : _over(over), _under(under), _sign(sign), _chordAt(chordAt), _length(chordAt.size()),
+          _inside{FenwickTree(2 * _length), FenwickTree(2 * _length)}, _outside{FenwickTree(2 * _length), FenwickTree(2 * _length)}
+    {
+    }
+
+    /*
+        @brief Moves the window to [first, last], 0 <= first < L and first - 1 <= last < first + L - 1.
+        The window shrinks to its common part with the new one before growing, so it never
+        covers a position twice.
+    */
+    void moveTo(int64_t first, int64_t last)
+    {
+        while (_first < first && _first <= _last)
+            popFront();
+        while (_last > last && _last >= _first)
+            popBack();
+        if (_first > _last)
+        {
+            _first = first;
+            _last = first - 1;
+        }
+        while (_first > first)
+            pushFront();
+        while (_last < last)
+            pushBack();
+    }
+
+    int64_t pairs() const { return _pairs; }
+    int64_t orderedPairs() const { return _orderedPairs; }
+
+private:
+    const std::vector<uint32_t> &_over, &_under;
+    const std::vector<int8_t> &_sign;
+    const std::vector<uint32_t> &_chordAt;
+    const int64_t _length;
+
+    int64_t _first = 0, _last = -1;
+    int64_t _pairs = 0, _orderedPairs = 0;
+
+    // crossing chords by the position of their end in the window and of the other one,
+    // index 1 for the chords met over in the window and 0 for the ones met under
+    FenwickTree _inside[2], _outside[2];
+    int64_t _weight[2] = {0, 0};
+
+    // end of @p chord other than @p position, placed in [_first, _first + L)
+    int64_t otherEnd(uint32_t chord, int64_t position) const
+    {
+        const int64_t other = (_over[chord] == position) ? _under[chord] : _over[chord];
+        return (other >= _first) ? other : other + _length;
+    }
+
+    void insert(uint32_t chord, bool isOver, int64_t inside, int64_t outside)
+    {
+        _inside[isOver].add(inside, _sign[chord]);
+        _outside[isOver].add(outside, _sign[chord]);
+        _weight[isOver] += _sign[chord];
+    }
+
+    void erase(uint32_t chord, bool isOver, int64_t inside, int64_t outside)
+    {
+        _inside[isOver].add(inside, -_sign[chord]);
+        _outside[isOver].add(outside, -_sign[chord]);
+        _weight[isOver] -= _sign[chord];
+    }
+
+    // a chord with its ends at @p inside in the window and first outside
+    void countFirstOutside(uint32_t chord, bool isOver, int64_t inside, int64_t direction)
+    {
+        const int64_t weight = isOver ? _weight[0] - _inside[0].prefix(inside + 1) : _inside[1].prefix(inside);
+        _pairs += direction * _sign[chord] * weight;
+        _orderedPairs += isOver ? direction * _sign[chord] * weight : 0;
+    }
+
+    // a chord with its ends at @p inside in the window and last outside
+    void countLastOutside(uint32_t chord, bool isOver, int64_t inside, int64_t direction)
+    {
+        const int64_t weight = isOver ? _weight[0] - _inside[0].prefix(inside + 1) : _inside[1].prefix(inside);
+        _pairs += direction * _sign[chord] * weight;
+        _orderedPairs += isOver ? 0 : direction * _sign[chord] * weight;
+    }
+
+    // a chord with its end last in the window and @p outside out of it
+    void countLastInside(uint32_t chord, bool isOver, int64_t outside, int64_t direction)
+    {
+        if (isOver)
+            return;
+        _pairs += direction * _sign[chord] * _weight[1];
+        _orderedPairs += direction * _sign[chord] * _outside[1].prefix(outside);
+    }
+
+    // a chord with its end first in the window and @p outside out of it
+    void countFirstInside(uint32_t chord, bool isOver, int64_t outside, int64_t direction)
+    {
+        if (!isOver)
+            return;
+        _pairs += direction * _sign[chord] * _weight[0];
+        _orderedPairs += direction * _sign[chord] * (_weight[0] - _outside[0].prefix(outside + 1));
+    }
+
+    void pushBack()
+    {
+        const int64_t added = _last + 1, position = added % _length;
+        const uint32_t chord = _chordAt[position];
+        const bool isOver = _over[chord] == position;
+        const int64_t other = otherEnd(chord, position);
+        if (other <= _last)
+        {
+            // the chord stops crossing, its end outside was the first one
+            erase(chord, !isOver, other, added);
+            countFirstOutside(chord, !isOver, other, -1);
+        }
+        else
+        {
+            countLastInside(chord, isOver, other, 1);
+            insert(chord, isOver, added, other);
+        }
+        _last = added;
+    }
+
+    void pushFront()
+    {
+        const int64_t added = _first - 1;
+        const uint32_t chord = _chordAt[added];
+        const bool isOver = _over[chord] == added;
+        const int64_t other = otherEnd(chord, added);
+        if (other <= _last)
+        {
+            // the chord stops crossing, its end outside was the last one
+            erase(chord, !isOver, other, added + _length);
+            countLastOutside(chord, !isOver, other, -1);
+        }
+        else
+        {
+            countFirstInside(chord, isOver, other, 1);
+            insert(chord, isOver, added, other);
+        }
+        _first = added;
+    }
+
+    void popBack()
+    {
+        const int64_t removed = _last, position = removed % _length;
+        const uint32_t chord = _chordAt[position];
+        const bool isOver = _over[chord] == position;
+        const int64_t other = otherEnd(chord, position);
+        _last = removed - 1;
+        if (other <= _last)
+        {
+            // the chord starts crossing, its end outside is the first one
+            countFirstOutside(chord, !isOver, other, 1);
+            insert(chord, !isOver, other, removed);
+        }
+        else
+        {
+            erase(chord, isOver, removed, other);
+            countLastInside(chord, isOver, other, -1);
+        }
+    }
+
+    void popFront()
+    {
+        const int64_t removed = _first;
+        const uint32_t chord = _chordAt[removed];
+        const bool isOver = _over[chord] == removed;
+        const int64_t other = otherEnd(chord, removed);
+        _first = removed + 1;
+        if (other <= _last)
+        {
+            // the chord starts crossing, its end outside is the last one
+            countLastOutside(chord, !isOver, other, 1);
+            insert(chord, !isOver, other, removed + _length);
+        }
+        else
+        {
+            erase(chord, isOver, removed, other);
+            countFirstInside(chord, isOver, other, -1);
+        }
+    }
+};
+}
+
+/*
+    @brief Builds the chord diagram of a knot from its Gauss code.
+    @param knot A consistent knot, the crossing signs are read from its planar diagram.
+*/
+GaussDiagram::GaussDiagram(const Knot &knot)
+{
+    const std::vector<int32_t> code = knot.gaussCode();
+    const size_t chordCount = code.size() / 2;
+
+    _over.resize(chordCount);
+    _under.resize(chordCount);
+    _sign.resize(chordCount);
+    _chordAt.resize(code.size());
+
+    for (uint32_t position = 0; position < code.size(); position++)
+    {
+        const uint32_t chord = std::abs(code[position]) - 1;
+        if (code[position] > 0)
+            _over[chord] = position;
+        else
+            _under[chord] = position;
+        _chordAt[position] = chord;
+    }
+
+    for (size_t chord = 0; chord < chordCount; chord++)
+        _sign[chord] = knot.getPlanarDiagram()[chord].sign ? 1 : -1;
+}
+
+/*
+    @brief Casson invariant in O(n log n).
+    Positions are swept from the end of the code, a chord met over first is inserted at its
+    over position once the sweep reaches its under position. A chord met under first then
+    counts the inserted chords whose over position lies between its two ends.
+*/
+int64_t GaussDiagram::v2() const
+{
+    FenwickTree overFirst(_chordAt.size());
+    int64_t sum = 0;
+
+    for (size_t position = _chordAt.size(); position-- > 0;)
+    {
+        const uint32_t chord = _chordAt[position];
+
+        if (position == _under[chord] && _over[chord] < _under[chord])
+            overFirst.add(_over[chord], _sign[chord]);
+        else if (position == _over[chord] && _under[chord] < _over[chord])
+            sum += _sign[chord] * (overFirst.prefix(_over[chord]) - overFirst.prefix(_under[chord] + 1));
+    }
+
+    return sum;
+}
+
+/*
+    @brief Third Vassiliev invariant in O(n^1.5 log n) instead of O(n^3).
+    Every chord is taken in turn as a pivot, the chords crossing it have one end on the arc
+    that goes from its under end to its over end and the other one on the opposite arc. Two
+    crossing chords a then c along the arc, with a met over and c met under there, form an
+    alternating triangle with the pivot when the other end of a comes before the other end
+    of c on the opposite arc, and a chain centered on the pivot otherwise. Both sums only
+    depend on the arc, so the arcs are visited in Mo's order: sorted by blocks of sqrt(n)
+    start positions, then by end position, an ArcWindow moves its ends O(n^1.5) times in
+    total. Each triangle is seen once per chord, hence the 1/3.
+*/
+int64_t GaussDiagram::v3() const
+{
+    const int64_t length = _chordAt.size();
+    if (length == 0)
+        return 0;
+
+    struct Arc
+    {
+        int64_t first, last;
+        size_t pivot;
+    };
+    std::vector<Arc> arcs(_sign.size());
+    for (size_t pivot = 0; pivot < _sign.size(); pivot++)
+    {
+        const int64_t first = (_under[pivot] + 1) % length;
+        arcs[pivot] = Arc{first, first + (_over[pivot] + length - _under[pivot]) % length - 2, pivot};
+    }
+
+    const int64_t block = std::max<int64_t>(1, length / std::sqrt((double)arcs.size()));
+    std::sort(arcs.begin(), arcs.end(), [block](const Arc &a, const Arc &b)
+    {
+        if (a.first / block != b.first / block)
+            return a.first / block < b.first / block;
+        // alternate the direction of the end from block to block
+        return ((a.first / block) % 2 == 0) ? a.last < b.last : a.last > b.last;
+    });
+
+    ArcWindow window(_over, _under, _sign, _chordAt);
+    int64_t triangles = 0, chains = 0;
+    for (const Arc &arc : arcs)
+    {
+        window.moveTo(arc.first, arc.last);
+        triangles += _sign[arc.pivot] * window.orderedPairs();
+        chains += _sign[arc.pivot] * (window.pairs() - window.orderedPairs());
+    }
+
+    return (2 * triangles + 3 * chains) / 6;
+}
+
+int64_t GaussDiagram::v2BruteForce() const
+{
+    int64_t sum = 0;
+    for (size_t i = 0; i < _sign.size(); i++)
+    {
+        for (size_t j = 0; j < _sign.size(); j++)
+        {
+            if (_under[i] < _over[j] && _over[j] < _over[i] && _over[i] < _under[j])
+                sum += _sign[i] * _sign[j];
+        }
+    }
+    return sum;
+}
+
+int64_t GaussDiagram::v3BruteForce() const
+{
+    struct End
+    {
+        uint32_t position, chord;
+        bool isOver;
+    };
+
+    int64_t triangles = 0, chains = 0;
+    for (size_t i = 0; i < _sign.size(); i++)
+    {
+        for (size_t j = i + 1; j < _sign.size(); j++)
+        {
+            for (size_t k = j + 1; k < _sign.size(); k++)
+            {
+                const bool ij = isCrossing(i, j), jk = isCrossing(j, k), ik = isCrossing(i, k);
+                if (ij + jk + ik < 2)
+                    continue;
+
+                std::array<End, 6> ends;
+                size_t e = 0;
+                for (size_t chord : {i, j, k})
+                {
+                    ends[e++] = End{_over[chord], (uint32_t)chord, true};
+                    ends[e++] = End{_under[chord], (uint32_t)chord, false};
+                }
+                std::sort(ends.begin(), ends.end(), [](const End &a, const End &b) { return a.position < b.position; });
+
+                const int64_t weight = _sign[i] * _sign[j] * _sign[k];
+                if (ij && jk && ik)
+                {
+                    bool alternating = true;
+                    for (size_t n = 0; n < 6; n++)
+                        alternating = alternating && ends[n].isOver != ends[(n + 1) % 6].isOver;
+                    triangles += alternating ? weight : 0;
+                    continue;
+                }
+
+                // rotate the ends to start at the under end of the middle chord
+                const size_t middle = !ik ? j : (!jk ? i : k);
+                while (ends[0].chord != middle || ends[0].isOver)
+                    std::rotate(ends.begin(), ends.begin() + 1, ends.end());
+
+                if (ends[3].chord == middle && ends[1].chord == ends[5].chord && ends[2].chord == ends[4].chord
+                    && ends[1].isOver && !ends[2].isOver && ends[4].isOver && !ends[5].isOver)
+                    chains += weight;
+            }
+        }
+    }
+
+    return (2 * triangles + chains) / 2;
+}
+
+// Read only
+size_t GaussDiagram::getChordCount() const { return _sign.size(); }
+uint32_t GaussDiagram::getOverPosition(size_t chord) const { return _over.at(chord); }
+uint32_t GaussDiagram::getUnderPosition(size_t chord) const { return _under.at(chord); }
+int8_t GaussDiagram::getSign(size_t chord) const { return _sign.at(chord); }
+
+/*
+    @brief True when the ends of the two chords interleave along the circle.
+*/
+bool GaussDiagram::isCrossing(size_t a, size_t b) const
+{
+    const uint32_t low = std::min(_over[a], _under[a]), high = std::max(_over[a], _under[a]);
+    const bool firstInside = low < _over[b] && _over[b] < high;
+    const bool secondInside = low < _under[b] && _under[b] < high;
+    return firstInside != secondInside;
+}
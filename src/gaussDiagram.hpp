@@ -0,0 +1,52 @@
+#pragma once
+
+#include "knot.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class GaussDiagram
+ * @brief Chord view of a knot diagram used to evaluate Gauss diagram formulas of
+ *        finite-type (Vassiliev) invariants.
+ *
+ * Every crossing is a chord joining the positions, along the Gauss code, where the knot
+ * passes over and under it. Positions are numbered 0..2n-1 from the head of arc 1.
+ *
+ * Formulas (Polyak-Viro), with e the crossing signs:
+ * - v2: sum of e_i e_j over pairs met in the order under_i, over_j, over_i, under_j.
+ * - v3: sum of e_i e_j e_k over triples of pairwise crossing chords whose endpoints
+ *   alternate over/under around the circle, plus half the sum over chains i - j - k where,
+ *   going around from under_j, one meets over_i, under_k, over_j, over_k, under_i.
+ *
+ * v2 is the Casson invariant (second Conway coefficient), v3 is 1 on the right-handed trefoil.
+ *
+ * Cost: v2() counts its chord pairs with a Fenwick tree in O(n log n). v3() counts the
+ * triangle and chain terms of every pivot chord on its arc, the arcs are visited in Mo's
+ * order by a window whose ends move O(n^1.5) times, each move updating Fenwick trees in
+ * O(log n), O(n^1.5 log n) overall.
+ */
+class GaussDiagram
+{
+public:
+    GaussDiagram(const Knot &knot);
+
+    int64_t v2() const;
+    int64_t v3() const;
+
+    // direct evaluation of the formulas, O(n^2) and O(n^3), kept as a reference
+    int64_t v2BruteForce() const;
+    int64_t v3BruteForce() const;
+
+    // read only
+    size_t getChordCount() const;
+    uint32_t getOverPosition(size_t chord) const;
+    uint32_t getUnderPosition(size_t chord) const;
+    int8_t getSign(size_t chord) const;
+
+private:
+    std::vector<uint32_t> _over, _under; // positions of the two ends of every chord
+    std::vector<int8_t> _sign;
+    std::vector<uint32_t> _chordAt;      // chord passing at every position
+
+    bool isCrossing(size_t a, size_t b) const;
+};
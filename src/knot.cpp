@@ -1,32 +1,757 @@
 #include "knot.hpp"
 #include "exception.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+
+Knot::Knot() {}
 
 /*
     @brief Constructs a Knot object from a given planar diagram.
     @param planarDiagram A vector of crossings representing the knot's planar diagram.
     ! planarDiagram must be simplified to protect it from isomophism ambiguity
 */
-Knot::Knot(const std::vector<crossing> &planarDiagram)
+Knot::Knot(const std::vector<crossing> &planarDiagram) : _planarDiagram(planarDiagram)
+{
+    if(!isConcistent())
+    {
+      throw kle::InconsistentPlanarDiagram("arcs must be labeled 1 to 2n, enter and leave exactly one crossing each and form a single component.");
+    }
+}
+
+/*
+    @brief Alexander matrix of the knot, one row per crossing and one column per arc (the
+    part of the knot between two undercrossings), entries in Z[t, 1/t].
+    A positive crossing with over arc k, incoming under arc i and outgoing under arc j gives
+    the row (1 - t) x_k + t x_i - x_j, a negative one (t - 1) x_k + x_i - t x_j.
+    Columns are numbered by the first edge of every arc along the orientation.
+    Source: Knot Theory by Charles Livingston, chapter Section 3.5. The Alexander Polynomial
+*/
+std::vector<std::vector<Polynomial>> Knot::alexanderMatrix() const
 {
-    if(isConcistent())
+    const size_t n = _planarDiagram.size();
+
+    // an arc runs through its over crossings and ends at the next under crossing
+    std::vector<size_t> arcOfEdge(2 * n + 1, SIZE_MAX), nextEdge(2 * n + 1, 0);
+    std::vector<bool> startsArc(2 * n + 1, false);
+    for (const crossing &c : _planarDiagram)
     {
-      throw kle::InconsistentPlanarDiagram("");
+        nextEdge[c.over_in()] = c.over_out();
+        startsArc[c.under_out()] = true;
     }
 
-    _planarDiagram = std::move(planarDiagram);
+    size_t arcCount = 0;
+    for (uint16_t edge = 1; edge <= 2 * n; edge++)
+    {
+        if (!startsArc[edge])
+            continue;
+        for (uint16_t e = edge; arcOfEdge[e] == SIZE_MAX; e = nextEdge[e])
+        {
+            arcOfEdge[e] = arcCount;
+            if (nextEdge[e] == 0)
+                break;
+        }
+        arcCount++;
+    }
+
+    const Polynomial one(std::vector<Term>{Term{1, 0}}, 0, 0), t(std::vector<Term>{Term{1, 1}}, 1, 1);
+    std::vector<std::vector<Polynomial>> matrix(n, std::vector<Polynomial>(arcCount));
+    for (size_t row = 0; row < n; row++)
+    {
+        const crossing &c = _planarDiagram[row];
+        std::vector<Polynomial> &relation = matrix[row];
+        if (c.sign)
+        {
+            relation[arcOfEdge[c.over_in()]] += one - t;
+            relation[arcOfEdge[c.under_in()]] += t;
+            relation[arcOfEdge[c.under_out()]] -= one;
+        }
+        else
+        {
+            relation[arcOfEdge[c.over_in()]] += t - one;
+            relation[arcOfEdge[c.under_in()]] += one;
+            relation[arcOfEdge[c.under_out()]] -= t;
+        }
+    }
+
+    return matrix;
 }
 
 /*
+    @brief Determinant of a square polynomial matrix by fraction-free (Bareiss) elimination,
+    every division by the previous pivot is exact.
+*/
+static Polynomial bareissDeterminant(std::vector<std::vector<Polynomial>> matrix)
+{
+    const size_t size = matrix.size();
+    Polynomial previousPivot(std::vector<Term>{Term{1, 0}}, 0, 0);
+    double sign = 1;
 
-    Source: Knot Theory by Charles Livingston, chapter Section 3.5. The Alexander Polynomial
+    for (size_t k = 0; k + 1 < size; k++)
+    {
+        if (matrix[k][k].isZero())
+        {
+            size_t pivotRow = k + 1;
+            while (pivotRow < size && matrix[pivotRow][k].isZero())
+                pivotRow++;
+            if (pivotRow == size)
+                return Polynomial();
+            std::swap(matrix[k], matrix[pivotRow]);
+            sign = -sign;
+        }
+
+        for (size_t i = k + 1; i < size; i++)
+        {
+            for (size_t j = k + 1; j < size; j++)
+                matrix[i][j] = (matrix[i][j] * matrix[k][k] - matrix[i][k] * matrix[k][j]) / previousPivot;
+        }
+        previousPivot = matrix[k][k];
+    }
+
+    return (size == 0) ? Polynomial(std::vector<Term>{Term{1, 0}}, 0, 0) : matrix[size - 1][size - 1] * sign;
+}
+
+/*
+    @brief Representative of a Laurent polynomial up to units +-t^k: centered on degree 0
+    and positive at t = 1 (positive leading coefficient when it vanishes there).
+*/
+static Polynomial normalizeUpToUnits(Polynomial p)
+{
+    p.simplify();
+    if (p.isZero())
+        return Polynomial();
+
+    const DEGREE_TYPE shift = -(p.Terms.front().degree + p.Terms.back().degree) / 2;
+    const double value = p.evaluate(1);
+    const double sign = (value < 0 || (value == 0 && p.Terms.back().coefficient < 0)) ? -1 : 1;
+    return p * Polynomial(std::vector<Term>{Term{sign, shift}}, shift, shift);
+}
+
+/*
+    @brief Removes the unit entries (+-t^k) of @p matrix one at a time: the pivot column is
+    cleared in the other rows, then the pivot row and column are deleted. The ideal of the
+    minors of size s of the input is the ideal of the minors of size s - eliminated of the output.
+    @return The number of pivots eliminated.
+*/
+static size_t eliminateUnitPivots(std::vector<std::vector<Polynomial>> &matrix)
+{
+    size_t eliminated = 0;
+    for (bool found = true; found && !matrix.empty();)
+    {
+        found = false;
+        for (size_t row = 0; row < matrix.size() && !found; row++)
+        {
+            for (size_t column = 0; column < matrix[row].size() && !found; column++)
+            {
+                if (!matrix[row][column].isUnit())
+                    continue;
+
+                const Polynomial pivot = matrix[row][column];
+                for (size_t i = 0; i < matrix.size(); i++)
+                {
+                    if (i == row || matrix[i][column].isZero())
+                        continue;
+                    const Polynomial factor = matrix[i][column] / pivot;
+                    for (size_t j = 0; j < matrix[i].size(); j++)
+                    {
+                        if (!matrix[row][j].isZero())
+                            matrix[i][j] -= factor * matrix[row][j];
+                    }
+                }
+
+                matrix.erase(matrix.begin() + row);
+                for (std::vector<Polynomial> &relation : matrix)
+                    relation.erase(relation.begin() + column);
+                eliminated++;
+                found = true;
+            }
+        }
+    }
+    return eliminated;
+}
+
+/*
+    @brief Next combination of @p combination.size() increasing indices below @p bound.
+    @return False after the last one.
+*/
+static bool nextCombination(std::vector<size_t> &combination, size_t bound)
+{
+    const size_t size = combination.size();
+    for (size_t i = size; i-- > 0;)
+    {
+        if (combination[i] < bound - size + i)
+        {
+            combination[i]++;
+            for (size_t j = i + 1; j < size; j++)
+                combination[j] = combination[j - 1] + 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+    @brief Alexander polynomials of the knot, Delta_order is the gcd of the minors of size
+    n - order of the Alexander matrix (Delta_1 is the Alexander polynomial, Delta_2 the
+    second one, which divides it). Normalized up to units by normalizeUpToUnits().
+    Delta_1 is a single first minor. For higher orders the matrix is first shrunk: the
+    columns sum to 0 so one of them can be dropped, then the unit entries are eliminated.
+    The gcd starts from Delta_(order - 1), a multiple of the result, takes one minor at a
+    time and stops as soon as it is a unit.
+*/
+Polynomial Knot::alexanderPolynomial(size_t order) const
+{
+    const Polynomial unit(std::vector<Term>{Term{1, 0}}, 0, 0);
+    const size_t n = _planarDiagram.size();
+    if (order == 0)
+        return Polynomial();
+    if (order >= n)
+        return unit;
+
+    std::vector<std::vector<Polynomial>> matrix = alexanderMatrix();
+    for (std::vector<Polynomial> &relation : matrix)
+        relation.pop_back();
+
+    if (order == 1)
+    {
+        matrix.pop_back();
+        return normalizeUpToUnits(bareissDeterminant(matrix));
+    }
+
+    Polynomial divisor = alexanderPolynomial(order - 1);
+    const size_t eliminated = eliminateUnitPivots(matrix);
+    if (divisor.isUnit() || n - order <= eliminated)
+        return unit;
+
+    const size_t minorSize = n - order - eliminated;
+    std::vector<size_t> rows(minorSize), columns(minorSize);
+    for (size_t i = 0; i < minorSize; i++)
+        rows[i] = i;
+    do
+    {
+        for (size_t i = 0; i < minorSize; i++)
+            columns[i] = i;
+        do
+        {
+            std::vector<std::vector<Polynomial>> minor(minorSize, std::vector<Polynomial>(minorSize));
+            for (size_t i = 0; i < minorSize; i++)
+            {
+                for (size_t j = 0; j < minorSize; j++)
+                    minor[i][j] = matrix[rows[i]][columns[j]];
+            }
+
+            divisor = Polynomial::gcd(divisor, bareissDeterminant(minor));
+            if (divisor.isUnit())
+                return unit;
+        } while (nextCombination(columns, matrix[0].size()));
+    } while (nextCombination(rows, matrix.size()));
+
+    return normalizeUpToUnits(divisor);
+}
+
+/*
+    @brief Writes the two relations of a crossing in the arc presentation of the knot group.
+    @param matrix Matrix with one column per arc, rows @p row and @p row + 1 are overwritten.
+    The first relation identifies the over arcs, the second is the Fox derivative of the
+    Wirtinger relation evaluated at t (its coefficients sum to zero).
+*/
+static void fillCrossingRelations(arma::mat &matrix, size_t row, const crossing &c, double t)
+{
+    for (size_t col = 0; col < matrix.n_cols; col++)
+    {
+        matrix(row, col) = 0;
+        matrix(row + 1, col) = 0;
+    }
+
+    matrix(row, c.over_in() - 1) += 1;
+    matrix(row, c.over_out() - 1) -= 1;
+
+    if (c.sign)
+    {
+        matrix(row + 1, c.over_in() - 1) += 1 - t;
+        matrix(row + 1, c.under_in() - 1) += t;
+        matrix(row + 1, c.under_out() - 1) -= 1;
+    }
+    else
+    {
+        matrix(row + 1, c.over_in() - 1) += t - 1;
+        matrix(row + 1, c.under_in() - 1) += 1;
+        matrix(row + 1, c.under_out() - 1) -= t;
+    }
+}
+
+/*
+    @brief Presentation matrix of the Alexander module evaluated at t.
+    @return A 2n x 2n matrix, rows 2i and 2i + 1 hold the relations of crossing i and
+    column j the arc j + 1. At t = -1 it presents the Fox colorings of the knot.
+*/
+arma::mat Knot::presentationMatrix(double t) const
+{
+    arma::mat matrix(2 * _planarDiagram.size(), 2 * _planarDiagram.size());
+    for (size_t i = 0; i < _planarDiagram.size(); i++)
+        fillCrossingRelations(matrix, 2 * i, _planarDiagram[i], t);
+
+    return matrix;
+}
+
+/*
+    @brief Coloring matrix of the knot, see presentationMatrix().
+*/
+arma::Mat<int> Knot::colorMatrix() const { return arma::conv_to<arma::Mat<int>>::from(presentationMatrix(-1)); }
+
+/*
+    @brief Determinant of the knot, |det| of the coloring matrix without the second
+    relation of the first crossing (it follows from the others) and without the first arc.
+    The factorization is kept and updated by changeCrossing(), the value is exact.
+    ! throws InvariantOverflowException if the determinant doesn't fit on 64 bits.
+*/
+uint64_t Knot::determinant() const
+{
+    if (_planarDiagram.empty())
+        return 1;
+
+    if (!_coloringFactored)
+    {
+        _coloring.factor(reducedColoringMatrix(), determinantBits());
+        _coloringFactored = true;
+    }
+    return _coloring.absoluteDeterminant();
+}
+
+/*
+    @brief Bound on log2 of the determinant, which a crossing change keeps valid.
+    For a planar diagram the determinant counts the spanning trees of the Tait graph with
+    signs, there are at most as many as the products of the degrees of all vertices but one,
+    so for n edges and x + 1 vertices at most (2n / x)^x <= e^(2n / e). Other diagrams are left
+    to Hadamard's bound.
+*/
+double Knot::determinantBits() const
+{
+    if (!isPlanar())
+        return std::numeric_limits<double>::infinity();
+    return 2.0 * _planarDiagram.size() / (std::exp(1.0) * std::log(2.0));
+}
+
+/*
+    @brief Switches the over and under strands of a crossing.
+    @param i Index of the crossing in the planar diagram.
+    Only the two relations of the crossing change, so a factored coloring matrix gets a
+    rank-2 update instead of being rebuilt.
+*/
+void Knot::changeCrossing(size_t i)
+{
+    const crossing old = _planarDiagram.at(i);
+    _planarDiagram[i] = crossing(old.under_in(), old.over_out(), old.under_out(), old.over_in(), !old.sign);
+
+    if (!_coloringFactored)
+        return;
+
+    const size_t arcCount = 2 * _planarDiagram.size();
+    arma::mat relations(2, arcCount);
+    fillCrossingRelations(relations, 0, _planarDiagram[i], -1);
+    relations.shed_col(0);
+
+    if (i == 0)
+        _coloring.updateRows(arma::uvec{0}, relations.rows(0, 0));
+    else
+        _coloring.updateRows(arma::uvec{2 * i - 1, 2 * i}, relations);
+}
+
+/*
+    @brief Gauss code of the knot read from arc 1 along the orientation.
+    @return One entry per passage through a crossing, i + 1 when crossing i is passed
+    over and -(i + 1) when it is passed under.
+    The crossings are followed from arc to arc, the labels don't have to be consecutive
+    along the knot.
+*/
+std::vector<int32_t> Knot::gaussCode() const
+{
+    const size_t arcCount = 2 * _planarDiagram.size();
+    std::vector<uint32_t> head(arcCount + 1);
+    for (size_t i = 0; i < _planarDiagram.size(); i++)
+    {
+        head[_planarDiagram[i].over_in()] = 4 * i;
+        head[_planarDiagram[i].under_in()] = 4 * i + 3;
+    }
+
+    std::vector<int32_t> code;
+    code.reserve(arcCount);
+    for (uint16_t arc = 1; code.size() < arcCount;)
+    {
+        const uint32_t slot = head[arc];
+        const crossing &c = _planarDiagram[slot / 4];
+        const int32_t passage = slot / 4 + 1;
+        code.push_back((slot % 4 == 0) ? passage : -passage);
+        arc = (slot % 4 == 0) ? c.over_out() : c.under_out();
+    }
+    return code;
+}
+
+/*
+    @brief Checks that the diagram can be drawn on the sphere without extra crossings.
+    The sign of a crossing fixes the counterclockwise order of its arcs: over in, under in,
+    over out, under out when positive and over in, under out, over out, under in when
+    negative. The diagram is planar when tracing the faces of that embedding gives
+    V - E + F = 2, that is n + 2 faces.
 */
-arma::Mat<std::string> Knot::alexanderMatrix() const
+bool Knot::isPlanar() const
 {
-    
+    if (_planarDiagram.empty())
+        return true;
+
+    const size_t halfEdges = 4 * _planarDiagram.size();
+    std::vector<uint16_t> label(halfEdges);
+    for (size_t i = 0; i < _planarDiagram.size(); i++)
+    {
+        const crossing &c = _planarDiagram[i];
+        label[4 * i] = c.over_in();
+        label[4 * i + 1] = c.sign ? c.under_in() : c.under_out();
+        label[4 * i + 2] = c.over_out();
+        label[4 * i + 3] = c.sign ? c.under_out() : c.under_in();
+    }
+
+    // every arc joins two half edges
+    std::vector<uint32_t> firstEnd(2 * _planarDiagram.size() + 1, UINT32_MAX), twin(halfEdges);
+    for (uint32_t h = 0; h < halfEdges; h++)
+    {
+        if (firstEnd[label[h]] == UINT32_MAX)
+            firstEnd[label[h]] = h;
+        else
+        {
+            twin[h] = firstEnd[label[h]];
+            twin[firstEnd[label[h]]] = h;
+        }
+    }
 
+    std::vector<bool> visited(halfEdges, false);
+    size_t faces = 0;
+    for (uint32_t h = 0; h < halfEdges; h++)
+    {
+        if (visited[h])
+            continue;
+
+        faces++;
+        for (uint32_t e = h; !visited[e]; e = (twin[e] & ~3u) | ((twin[e] + 1) & 3u))
+            visited[e] = true;
+    }
+
+    return faces == _planarDiagram.size() + 2;
+}
+
+const std::vector<crossing> &Knot::getPlanarDiagram() const { return _planarDiagram; }
+
+arma::mat Knot::reducedColoringMatrix() const
+{
+    arma::mat matrix = presentationMatrix(-1);
+    matrix.shed_row(1);
+    matrix.shed_col(0);
+    return matrix;
+}
+
+/*
+    @brief Finds the representative label of an arc merged by reduce().
+*/
+static uint16_t findArc(std::vector<uint16_t> &mergedInto, uint16_t arc)
+{
+    while (mergedInto[arc] != arc)
+    {
+        mergedInto[arc] = mergedInto[mergedInto[arc]];
+        arc = mergedInto[arc];
+    }
+    return arc;
 }
 
-void Knot::reduce() const
+/*
+    @brief Simplifies the diagram by undoing Reidemeister I and II moves until none is left.
+    A crossing is a kink (move I) when one of its outgoing arcs comes straight back in. Two
+    crossings form a bigon (move II) when an arc goes over both and another arc under both,
+    the two arcs are adjacent at both crossings and, the knot being connected, they bound a
+    face. Removing a crossing joins its incoming and outgoing arcs on each strand. Arcs are
+    relabeled 1 to 2n afterwards and a factored coloring matrix is downdated, see reduceColoring().
+*/
+void Knot::reduce()
 {
+    const size_t arcCount = 2 * _planarDiagram.size();
+    std::vector<uint16_t> mergedInto(arcCount + 1);
+    for (size_t arc = 0; arc <= arcCount; arc++)
+        mergedInto[arc] = arc;
+
+    // arcs joined when their crossing is removed, the first representative into the second
+    std::vector<std::pair<uint16_t, uint16_t>> merges;
+    auto mergeArcs = [&](uint16_t out, uint16_t in)
+    {
+        out = findArc(mergedInto, out);
+        in = findArc(mergedInto, in);
+        if (out != in)
+        {
+            mergedInto[out] = in;
+            merges.push_back({out, in});
+        }
+    };
+
+    std::vector<bool> removed(_planarDiagram.size(), false);
+    std::vector<uint32_t> overHead(arcCount + 1), underHead(arcCount + 1);
+    auto removeCrossing = [&](size_t i)
+    {
+        const crossing &c = _planarDiagram[i];
+        mergeArcs(c.over_out(), c.over_in());
+        mergeArcs(c.under_out(), c.under_in());
+        removed[i] = true;
+    };
+
+    for (bool changed = true; changed;)
+    {
+        changed = false;
+        std::fill(overHead.begin(), overHead.end(), UINT32_MAX);
+        std::fill(underHead.begin(), underHead.end(), UINT32_MAX);
+        for (size_t i = 0; i < _planarDiagram.size(); i++)
+        {
+            if (!removed[i])
+            {
+                overHead[findArc(mergedInto, _planarDiagram[i].over_in())] = i;
+                underHead[findArc(mergedInto, _planarDiagram[i].under_in())] = i;
+            }
+        }
+
+        for (size_t i = 0; i < _planarDiagram.size(); i++)
+        {
+            if (removed[i])
+                continue;
+
+            const crossing &c = _planarDiagram[i];
+            const uint16_t overOut = findArc(mergedInto, c.over_out()), underOut = findArc(mergedInto, c.under_out());
+            const uint16_t overIn = findArc(mergedInto, c.over_in()), underIn = findArc(mergedInto, c.under_in());
+
+            if (overOut == underIn || underOut == overIn)
+            {
+                removeCrossing(i);
+                changed = true;
+                continue;
+            }
+
+            // the next crossing over the over strand, under the under strand either way
+            const uint32_t j = overHead[overOut];
+            if (j == UINT32_MAX || j == i || removed[j])
+                continue;
+
+            const crossing &d = _planarDiagram[j];
+            if (underHead[underOut] == j || findArc(mergedInto, d.under_out()) == underIn)
+            {
+                removeCrossing(i);
+                removeCrossing(j);
+                changed = true;
+            }
+        }
+    }
+
+    std::vector<crossing> reduced;
+    for (size_t i = 0; i < _planarDiagram.size(); i++)
+    {
+        if (removed[i])
+            continue;
+
+        crossing c = _planarDiagram[i];
+        for (uint16_t &arc : c.arcs)
+            arc = findArc(mergedInto, arc);
+        reduced.push_back(c);
+    }
+
+    if (reduced.empty())
+    {
+        _planarDiagram.clear();
+        _coloringFactored = false;
+        return;
+    }
+
+    const std::vector<crossing> representatives = reduced;
+    relabelPlanarDiagram(reduced);
+    if (_coloringFactored)
+    {
+        std::vector<uint16_t> newLabel(arcCount + 1, 0);
+        for (size_t i = 0; i < reduced.size(); i++)
+        {
+            for (size_t k = 0; k < 4; k++)
+                newLabel[representatives[i].arcs[k]] = reduced[i].arcs[k];
+        }
+        reduceColoring(removed, merges, newLabel);
+    }
+    _planarDiagram = reduced;
+}
 
+/*
+    @brief Carries the factored coloring matrix through reduce() instead of factoring it again.
+    @param removed Crossings removed by reduce(), some are kept.
+    @param merges Arcs joined by reduce() in order, the first representative into the second.
+    @param newLabel Label given by relabelPlanarDiagram() to the representative of every arc.
+    Joining two arcs adds the column of the first to the second, then the rows of the removed
+    crossings and the columns of the arcs they absorbed go away together. Arc 1 has no column:
+    an arc joined with it loses its own. When the new arc 1 is another arc, it trades its column
+    for the missing one, minus the sum of the others since the relations sum to 0. The removed
+    type-2 row of crossing 0 moves to the first kept crossing the same way it would in a new
+    matrix, and the columns are put in the order of the new labels.
+*/
+void Knot::reduceColoring(const std::vector<bool> &removed, const std::vector<std::pair<uint16_t, uint16_t>> &merges, const std::vector<uint16_t> &newLabel)
+{
+    // column j of the factored matrix holds arc j + 2
+    uint16_t missing = 1;
+    std::vector<size_t> removedColumns;
+    for (const auto &[out, in] : merges)
+    {
+        if (out == missing)
+        {
+            removedColumns.push_back(in - 2);
+            missing = in;
+        }
+        else
+        {
+            if (in != missing)
+                _coloring.addColumn(out - 2, in - 2);
+            removedColumns.push_back(out - 2);
+        }
+    }
+
+    const uint16_t first = std::find(newLabel.begin(), newLabel.end(), 1) - newLabel.begin();
+    if (first != missing)
+    {
+        for (uint16_t arc = 2; arc < newLabel.size(); arc++)
+        {
+            if (newLabel[arc] != 0 && arc != first && arc != missing)
+                _coloring.addColumn(arc - 2, first - 2);
+        }
+        _coloring.negateColumn(first - 2);
+    }
+
+    // row r of the factored matrix holds relation r + 1 of the full one, r = 0 apart
+    std::vector<size_t> removedRows;
+    const size_t firstKept = std::find(removed.begin(), removed.end(), false) - removed.begin();
+    for (size_t i = 0; i < removed.size(); i++)
+    {
+        if (removed[i] && i == 0)
+            removedRows.push_back(0);
+        else if (removed[i])
+            removedRows.insert(removedRows.end(), {2 * i - 1, 2 * i});
+    }
+    if (firstKept != 0)
+        removedRows.push_back(2 * firstKept);
+
+    std::sort(removedRows.begin(), removedRows.end());
+    std::sort(removedColumns.begin(), removedColumns.end());
+    _coloring.removeRowsAndColumns(arma::conv_to<arma::uvec>::from(removedRows), arma::conv_to<arma::uvec>::from(removedColumns));
+
+    // the kept columns stay in increasing order
+    std::vector<bool> gone(newLabel.size(), false);
+    for (size_t column : removedColumns)
+        gone[column + 2] = true;
+
+    arma::uvec order(2 * (removed.size() - std::count(removed.begin(), removed.end(), true)) - 1);
+    for (uint16_t arc = 2, position = 0; arc < newLabel.size(); arc++)
+    {
+        if (gone[arc])
+            continue;
+        const uint16_t held = (arc == first) ? missing : arc;
+        order(newLabel[held] - 2) = position++;
+    }
+    _coloring.permuteColumns(order);
+}
+
+
+/*
+    @brief Checks that the planar diagram describes a single closed component.
+    Each arc label in 1..2n must be the incoming arc of exactly one crossing and the
+    outgoing arc of exactly one crossing, and walking the arcs must visit all of them.
+*/
+bool Knot::isConcistent() const { return isConsistentPlanarDiagram(_planarDiagram); }
+
+/*
+    @brief Checks a planar diagram the way the Knot constructor does, see Knot::isConcistent().
+*/
+bool isConsistentPlanarDiagram(const std::vector<crossing> &planarDiagram)
+{
+    const size_t arcCount = 2 * planarDiagram.size();
+    std::vector<uint32_t> head(arcCount + 1, UINT32_MAX);
+    std::vector<uint8_t> tails(arcCount + 1, 0);
+
+    for (size_t i = 0; i < planarDiagram.size(); i++)
+    {
+        const crossing &c = planarDiagram[i];
+        for (uint16_t arc : c.arcs)
+        {
+            if (arc == 0 || arc > arcCount)
+                return false;
+        }
+        if (head[c.over_in()] != UINT32_MAX || head[c.under_in()] != UINT32_MAX || c.over_in() == c.under_in())
+            return false;
+        head[c.over_in()] = 4 * i;
+        head[c.under_in()] = 4 * i + 3;
+        tails[c.over_out()]++;
+        tails[c.under_out()]++;
+    }
+
+    for (size_t arc = 1; arc <= arcCount; arc++)
+    {
+        if (tails[arc] != 1)
+            return false;
+    }
+
+    // walk the diagram once, a link would close up before visiting every arc
+    size_t visited = 0;
+    for (uint16_t arc = 1; visited < arcCount; visited++)
+    {
+        const uint32_t slot = head[arc];
+        const crossing &c = planarDiagram[slot / 4];
+        arc = (slot % 4 == 0) ? c.over_out() : c.under_out();
+        if (arc == 1)
+            return visited + 1 == arcCount;
+    }
+    return arcCount == 0;
+}
+
+/*
+    @brief Renumbers the arcs of a planar diagram 1..2n following the orientation of the knot.
+    @param planarDiagram Crossings whose arc labels may be arbitrary (but pairwise consistent).
+    The walk starts on the incoming over arc of the first crossing.
+    ! throws InconsistentPlanarDiagram if the diagram has more than one component.
+*/
+void relabelPlanarDiagram(std::vector<crossing> &planarDiagram)
+{
+    if (planarDiagram.empty())
+        return;
+
+    uint16_t maxLabel = 0;
+    for (const crossing &c : planarDiagram)
+    {
+        for (uint16_t arc : c.arcs)
+            maxLabel = std::max(maxLabel, arc);
+    }
+
+    std::vector<uint32_t> head(maxLabel + 1, UINT32_MAX);
+    for (size_t i = 0; i < planarDiagram.size(); i++)
+    {
+        head[planarDiagram[i].over_in()] = 4 * i;
+        head[planarDiagram[i].under_in()] = 4 * i + 3;
+    }
+
+    std::vector<uint16_t> newLabel(maxLabel + 1, 0);
+    uint16_t arc = planarDiagram.front().over_in();
+    uint16_t next = 1;
+    while (newLabel[arc] == 0)
+    {
+        newLabel[arc] = next++;
+        const uint32_t slot = head[arc];
+        if (slot == UINT32_MAX)
+            throw kle::InconsistentPlanarDiagram("arc " + std::to_string(arc) + " does not enter any crossing.");
+
+        const crossing &c = planarDiagram[slot / 4];
+        arc = (slot % 4 == 0) ? c.over_out() : c.under_out();
+    }
+
+    if ((size_t)(next - 1) != 2 * planarDiagram.size())
+        throw kle::InconsistentPlanarDiagram("the planar diagram has more than one component.");
+
+    for (crossing &c : planarDiagram)
+    {
+        for (uint16_t &label : c.arcs)
+            label = newLabel[label];
+    }
 }
@@ -1,7 +1,10 @@
 #pragma once
 
+#include "Polynomials.hpp"
+#include "presentation.hpp"
 #include <armadillo>
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 /**
@@ -12,12 +15,13 @@
  */
 struct crossing
 {
-  crossing(uint16_t arcsA, uint16_t arcsB, uint16_t arcsC, uint16_t arcsD)
+  crossing(uint16_t arcsA, uint16_t arcsB, uint16_t arcsC, uint16_t arcsD, bool crossingSign = true)
   {
     arcs[0] = arcsA;
     arcs[1] = arcsB;
     arcs[2] = arcsC;
     arcs[3] = arcsD;
+    sign = crossingSign;
   }
 
   /// Identifiers of the four oriented arcs at the crossing.
@@ -26,24 +30,45 @@ struct crossing
   /// @brief True for a right-handed crossing, false for left-handed.
   bool sign;
 
-  inline uint16_t over_in() { return arcs[0]; }
-  inline uint16_t under_out() { return arcs[1]; }
-  inline uint16_t over_out() { return arcs[2]; }
-  inline uint16_t under_in() { return arcs[3]; }
+  inline uint16_t over_in() const { return arcs[0]; }
+  inline uint16_t under_out() const { return arcs[1]; }
+  inline uint16_t over_out() const { return arcs[2]; }
+  inline uint16_t under_in() const { return arcs[3]; }
 };
 
+void relabelPlanarDiagram(std::vector<crossing> &planarDiagram);
+bool isConsistentPlanarDiagram(const std::vector<crossing> &planarDiagram);
+
 class Knot
 {
 public:
   Knot();
   Knot(const std::vector<crossing> &planarDiagram);
 
-  arma::Mat<std::string> alexanderMatrix() const;
+  std::vector<std::vector<Polynomial>> alexanderMatrix() const;
+  Polynomial alexanderPolynomial(size_t order = 1) const;
   arma::Mat<int> colorMatrix() const;
+  arma::mat presentationMatrix(double t) const;
+  uint64_t determinant() const;
+
+  void changeCrossing(size_t i);
+  void reduce();
+
+  std::vector<int32_t> gaussCode() const;
+  bool isPlanar() const;
+
+  const std::vector<crossing> &getPlanarDiagram() const;
 
 private:
   std::vector<crossing> _planarDiagram;
 
+  // factorization of the coloring matrix, built by the first call to determinant()
+  mutable PresentationFactorization _coloring;
+  mutable bool _coloringFactored = false;
+
+  arma::mat reducedColoringMatrix() const;
+  double determinantBits() const;
+  void reduceColoring(const std::vector<bool> &removed, const std::vector<std::pair<uint16_t, uint16_t>> &merges, const std::vector<uint16_t> &newLabel);
+
   bool isConcistent() const;
-  void reduce() const;
 };
\ No newline at end of file
@@ -0,0 +1,346 @@
+#pragma once
+
+#include "fixedPolynomial.hpp"
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+inline constexpr size_t ALEXANDER_CAPACITY = 16;
+using AlexanderPolynomial = FixedPolynomial<ALEXANDER_CAPACITY>;
+
+/**
+ * @brief Known invariants of a prime knot (Rolfsen table name), used as reference values.
+ * The Alexander polynomial is Conway normalized: symmetric under t -> 1/t and 1 at t = 1.
+ */
+struct KnotTableEntry
+{
+    std::string_view name;
+    uint16_t crossings;
+    bool alternating;
+    uint64_t determinant;
+    AlexanderPolynomial alexander;
+};
+
+/*
+    @brief Symmetric Alexander polynomial from its coefficients, lowest degree first.
+*/
+constexpr AlexanderPolynomial symmetricAlexander(std::initializer_list<double> coefficients)
+{
+    return AlexanderPolynomial(coefficients, -(DEGREE_TYPE)(coefficients.size() / 2));
+}
+
+/*
+    @brief Second coefficient of the Conway polynomial, equal to the Vassiliev invariant v2.
+    With Delta = c0 + sum c_k (t^k + t^-k), a2 = sum k^2 c_k.
+*/
+constexpr int64_t secondConwayCoefficient(const AlexanderPolynomial &alexander)
+{
+    int64_t sum = 0;
+    for (DEGREE_TYPE k = 1; k <= alexander.getLeadingDegree(); k++)
+        sum += (int64_t)k * k * (int64_t)alexander.getCoefficient(k);
+    return sum;
+}
+
+// prime knots up to 10 crossings, mirror images are not distinguished
+inline constexpr std::array<KnotTableEntry, 250> KNOT_TABLE{{
+    {"0_1", 0, true, 1, symmetricAlexander({1})},
+    {"3_1", 3, true, 3, symmetricAlexander({1, -1, 1})},
+    {"4_1", 4, true, 5, symmetricAlexander({-1, 3, -1})},
+    {"5_1", 5, true, 5, symmetricAlexander({1, -1, 1, -1, 1})},
+    {"5_2", 5, true, 7, symmetricAlexander({2, -3, 2})},
+    {"6_1", 6, true, 9, symmetricAlexander({-2, 5, -2})},
+    {"6_2", 6, true, 11, symmetricAlexander({-1, 3, -3, 3, -1})},
+    {"6_3", 6, true, 13, symmetricAlexander({1, -3, 5, -3, 1})},
+    {"7_1", 7, true, 7, symmetricAlexander({1, -1, 1, -1, 1, -1, 1})},
+    {"7_2", 7, true, 11, symmetricAlexander({3, -5, 3})},
+    {"7_3", 7, true, 13, symmetricAlexander({2, -3, 3, -3, 2})},
+    {"7_4", 7, true, 15, symmetricAlexander({4, -7, 4})},
+    {"7_5", 7, true, 17, symmetricAlexander({2, -4, 5, -4, 2})},
+    {"7_6", 7, true, 19, symmetricAlexander({-1, 5, -7, 5, -1})},
+    {"7_7", 7, true, 21, symmetricAlexander({1, -5, 9, -5, 1})},
+    {"8_1", 8, true, 13, symmetricAlexander({-3, 7, -3})},
+    {"8_2", 8, true, 17, symmetricAlexander({-1, 3, -3, 3, -3, 3, -1})},
+    {"8_3", 8, true, 17, symmetricAlexander({-4, 9, -4})},
+    {"8_4", 8, true, 19, symmetricAlexander({-2, 5, -5, 5, -2})},
+    {"8_5", 8, true, 21, symmetricAlexander({-1, 3, -4, 5, -4, 3, -1})},
+    {"8_6", 8, true, 23, symmetricAlexander({-2, 6, -7, 6, -2})},
+    {"8_7", 8, true, 23, symmetricAlexander({1, -3, 5, -5, 5, -3, 1})},
+    {"8_8", 8, true, 25, symmetricAlexander({2, -6, 9, -6, 2})},
+    {"8_9", 8, true, 25, symmetricAlexander({-1, 3, -5, 7, -5, 3, -1})},
+    {"8_10", 8, true, 27, symmetricAlexander({1, -3, 6, -7, 6, -3, 1})},
+    {"8_11", 8, true, 27, symmetricAlexander({-2, 7, -9, 7, -2})},
+    {"8_12", 8, true, 29, symmetricAlexander({1, -7, 13, -7, 1})},
+    {"8_13", 8, true, 29, symmetricAlexander({2, -7, 11, -7, 2})},
+    {"8_14", 8, true, 31, symmetricAlexander({-2, 8, -11, 8, -2})},
+    {"8_15", 8, true, 33, symmetricAlexander({3, -8, 11, -8, 3})},
+    {"8_16", 8, true, 35, symmetricAlexander({1, -4, 8, -9, 8, -4, 1})},
+    {"8_17", 8, true, 37, symmetricAlexander({-1, 4, -8, 11, -8, 4, -1})},
+    {"8_18", 8, true, 45, symmetricAlexander({-1, 5, -10, 13, -10, 5, -1})},
+    {"8_19", 8, false, 3, symmetricAlexander({1, -1, 0, 1, 0, -1, 1})},
+    {"8_20", 8, false, 9, symmetricAlexander({1, -2, 3, -2, 1})},
+    {"8_21", 8, false, 15, symmetricAlexander({-1, 4, -5, 4, -1})},
+    {"9_1", 9, true, 9, symmetricAlexander({1, -1, 1, -1, 1, -1, 1, -1, 1})},
+    {"9_2", 9, true, 15, symmetricAlexander({4, -7, 4})},
+    {"9_3", 9, true, 19, symmetricAlexander({2, -3, 3, -3, 3, -3, 2})},
+    {"9_4", 9, true, 21, symmetricAlexander({3, -5, 5, -5, 3})},
+    {"9_5", 9, true, 23, symmetricAlexander({6, -11, 6})},
+    {"9_6", 9, true, 27, symmetricAlexander({2, -4, 5, -5, 5, -4, 2})},
+    {"9_7", 9, true, 29, symmetricAlexander({3, -7, 9, -7, 3})},
+    {"9_8", 9, true, 31, symmetricAlexander({-2, 8, -11, 8, -2})},
+    {"9_9", 9, true, 31, symmetricAlexander({2, -4, 6, -7, 6, -4, 2})},
+    {"9_10", 9, true, 33, symmetricAlexander({4, -8, 9, -8, 4})},
+    {"9_11", 9, true, 33, symmetricAlexander({-1, 5, -7, 7, -7, 5, -1})},
+    {"9_12", 9, true, 35, symmetricAlexander({-2, 9, -13, 9, -2})},
+    {"9_13", 9, true, 37, symmetricAlexander({4, -9, 11, -9, 4})},
+    {"9_14", 9, true, 37, symmetricAlexander({2, -9, 15, -9, 2})},
+    {"9_15", 9, true, 39, symmetricAlexander({-2, 10, -15, 10, -2})},
+    {"9_16", 9, true, 39, symmetricAlexander({2, -5, 8, -9, 8, -5, 2})},
+    {"9_17", 9, true, 39, symmetricAlexander({1, -5, 9, -9, 9, -5, 1})},
+    {"9_18", 9, true, 41, symmetricAlexander({4, -10, 13, -10, 4})},
+    {"9_19", 9, true, 41, symmetricAlexander({2, -10, 17, -10, 2})},
+    {"9_20", 9, true, 41, symmetricAlexander({-1, 5, -9, 11, -9, 5, -1})},
+    {"9_21", 9, true, 43, symmetricAlexander({-2, 11, -17, 11, -2})},
+    {"9_22", 9, true, 43, symmetricAlexander({1, -5, 10, -11, 10, -5, 1})},
+    {"9_23", 9, true, 45, symmetricAlexander({4, -11, 15, -11, 4})},
+    {"9_24", 9, true, 45, symmetricAlexander({-1, 5, -10, 13, -10, 5, -1})},
+    {"9_25", 9, true, 47, symmetricAlexander({-3, 12, -17, 12, -3})},
+    {"9_26", 9, true, 47, symmetricAlexander({1, -5, 11, -13, 11, -5, 1})},
+    {"9_27", 9, true, 49, symmetricAlexander({-1, 5, -11, 15, -11, 5, -1})},
+    {"9_28", 9, true, 51, symmetricAlexander({1, -5, 12, -15, 12, -5, 1})},
+    {"9_29", 9, true, 51, symmetricAlexander({1, -5, 12, -15, 12, -5, 1})},
+    {"9_30", 9, true, 53, symmetricAlexander({-1, 5, -12, 17, -12, 5, -1})},
+    {"9_31", 9, true, 55, symmetricAlexander({1, -5, 13, -17, 13, -5, 1})},
+    {"9_32", 9, true, 59, symmetricAlexander({1, -6, 14, -17, 14, -6, 1})},
+    {"9_33", 9, true, 61, symmetricAlexander({-1, 6, -14, 19, -14, 6, -1})},
+    {"9_34", 9, true, 69, symmetricAlexander({-1, 6, -16, 23, -16, 6, -1})},
+    {"9_35", 9, true, 27, symmetricAlexander({7, -13, 7})},
+    {"9_36", 9, true, 37, symmetricAlexander({-1, 5, -8, 9, -8, 5, -1})},
+    {"9_37", 9, true, 45, symmetricAlexander({2, -11, 19, -11, 2})},
+    {"9_38", 9, true, 57, symmetricAlexander({5, -14, 19, -14, 5})},
+    {"9_39", 9, true, 55, symmetricAlexander({-3, 14, -21, 14, -3})},
+    {"9_40", 9, true, 75, symmetricAlexander({1, -7, 18, -23, 18, -7, 1})},
+    {"9_41", 9, true, 49, symmetricAlexander({3, -12, 19, -12, 3})},
+    {"9_42", 9, false, 7, symmetricAlexander({-1, 2, -1, 2, -1})},
+    {"9_43", 9, false, 13, symmetricAlexander({-1, 3, -2, 1, -2, 3, -1})},
+    {"9_44", 9, false, 17, symmetricAlexander({1, -4, 7, -4, 1})},
+    {"9_45", 9, false, 23, symmetricAlexander({-1, 6, -9, 6, -1})},
+    {"9_46", 9, false, 9, symmetricAlexander({-2, 5, -2})},
+    {"9_47", 9, false, 27, symmetricAlexander({1, -4, 6, -5, 6, -4, 1})},
+    {"9_48", 9, false, 27, symmetricAlexander({-1, 7, -11, 7, -1})},
+    {"9_49", 9, false, 25, symmetricAlexander({3, -6, 7, -6, 3})},
+    {"10_1", 10, true, 17, symmetricAlexander({-4, 9, -4})},
+    {"10_2", 10, true, 23, symmetricAlexander({-1, 3, -3, 3, -3, 3, -3, 3, -1})},
+    {"10_3", 10, true, 25, symmetricAlexander({-6, 13, -6})},
+    {"10_4", 10, true, 27, symmetricAlexander({-3, 7, -7, 7, -3})},
+    {"10_5", 10, true, 33, symmetricAlexander({1, -3, 5, -5, 5, -5, 5, -3, 1})},
+    {"10_6", 10, true, 37, symmetricAlexander({-2, 6, -7, 7, -7, 6, -2})},
+    {"10_7", 10, true, 43, symmetricAlexander({-3, 11, -15, 11, -3})},
+    {"10_8", 10, true, 29, symmetricAlexander({-2, 5, -5, 5, -5, 5, -2})},
+    {"10_9", 10, true, 39, symmetricAlexander({-1, 3, -5, 7, -7, 7, -5, 3, -1})},
+    {"10_10", 10, true, 45, symmetricAlexander({3, -11, 17, -11, 3})},
+    {"10_11", 10, true, 43, symmetricAlexander({-4, 11, -13, 11, -4})},
+    {"10_12", 10, true, 47, symmetricAlexander({2, -6, 10, -11, 10, -6, 2})},
+    {"10_13", 10, true, 53, symmetricAlexander({2, -13, 23, -13, 2})},
+    {"10_14", 10, true, 57, symmetricAlexander({-2, 8, -12, 13, -12, 8, -2})},
+    {"10_15", 10, true, 43, symmetricAlexander({2, -6, 9, -9, 9, -6, 2})},
+    {"10_16", 10, true, 47, symmetricAlexander({-4, 12, -15, 12, -4})},
+    {"10_17", 10, true, 41, symmetricAlexander({1, -3, 5, -7, 9, -7, 5, -3, 1})},
+    {"10_18", 10, true, 51, symmetricAlexander({2, -7, 11, -11, 11, -7, 2})},
+    {"10_19", 10, true, 55, symmetricAlexander({-4, 14, -19, 14, -4})},
+    {"10_20", 10, true, 35, symmetricAlexander({-3, 9, -11, 9, -3})},
+    {"10_21", 10, true, 45, symmetricAlexander({-2, 7, -9, 9, -9, 7, -2})},
+    {"10_22", 10, true, 49, symmetricAlexander({-2, 6, -10, 13, -10, 6, -2})},
+    {"10_23", 10, true, 59, symmetricAlexander({2, -7, 13, -15, 13, -7, 2})},
+    {"10_24", 10, true, 55, symmetricAlexander({-4, 14, -19, 14, -4})},
+    {"10_25", 10, true, 65, symmetricAlexander({-2, 8, -14, 17, -14, 8, -2})},
+    {"10_26", 10, true, 61, symmetricAlexander({-2, 7, -13, 17, -13, 7, -2})},
+    {"10_27", 10, true, 71, symmetricAlexander({2, -8, 16, -19, 16, -8, 2})},
+    {"10_28", 10, true, 53, symmetricAlexander({4, -13, 19, -13, 4})},
+    {"10_29", 10, true, 63, symmetricAlexander({1, -7, 15, -17, 15, -7, 1})},
+    {"10_30", 10, true, 67, symmetricAlexander({-4, 17, -25, 17, -4})},
+    {"10_31", 10, true, 57, symmetricAlexander({4, -14, 21, -14, 4})},
+    {"10_32", 10, true, 69, symmetricAlexander({-2, 8, -15, 19, -15, 8, -2})},
+    {"10_33", 10, true, 65, symmetricAlexander({4, -16, 25, -16, 4})},
+    {"10_34", 10, true, 37, symmetricAlexander({3, -9, 13, -9, 3})},
+    {"10_35", 10, true, 49, symmetricAlexander({2, -12, 21, -12, 2})},
+    {"10_36", 10, true, 51, symmetricAlexander({-3, 13, -19, 13, -3})},
+    {"10_37", 10, true, 53, symmetricAlexander({4, -13, 19, -13, 4})},
+    {"10_38", 10, true, 59, symmetricAlexander({-4, 15, -21, 15, -4})},
+    {"10_39", 10, true, 61, symmetricAlexander({-2, 8, -13, 15, -13, 8, -2})},
+    {"10_40", 10, true, 75, symmetricAlexander({2, -8, 17, -21, 17, -8, 2})},
+    {"10_41", 10, true, 71, symmetricAlexander({1, -7, 17, -21, 17, -7, 1})},
+    {"10_42", 10, true, 81, symmetricAlexander({-1, 7, -19, 27, -19, 7, -1})},
+    {"10_43", 10, true, 73, symmetricAlexander({-1, 7, -17, 23, -17, 7, -1})},
+    {"10_44", 10, true, 79, symmetricAlexander({1, -7, 19, -25, 19, -7, 1})},
+    {"10_45", 10, true, 89, symmetricAlexander({-1, 7, -21, 31, -21, 7, -1})},
+    {"10_46", 10, true, 31, symmetricAlexander({-1, 3, -4, 5, -5, 5, -4, 3, -1})},
+    {"10_47", 10, true, 41, symmetricAlexander({1, -3, 6, -7, 7, -7, 6, -3, 1})},
+    {"10_48", 10, true, 49, symmetricAlexander({1, -3, 6, -9, 11, -9, 6, -3, 1})},
+    {"10_49", 10, true, 59, symmetricAlexander({3, -8, 12, -13, 12, -8, 3})},
+    {"10_50", 10, true, 53, symmetricAlexander({-2, 7, -11, 13, -11, 7, -2})},
+    {"10_51", 10, true, 67, symmetricAlexander({1, -7, 16, -19, 16, -7, 1})},
+    {"10_52", 10, true, 59, symmetricAlexander({2, -7, 13, -15, 13, -7, 2})},
+    {"10_53", 10, true, 73, symmetricAlexander({6, -18, 25, -18, 6})},
+    {"10_54", 10, true, 47, symmetricAlexander({2, -6, 10, -11, 10, -6, 2})},
+    {"10_55", 10, true, 61, symmetricAlexander({5, -15, 21, -15, 5})},
+    {"10_56", 10, true, 65, symmetricAlexander({-2, 8, -14, 17, -14, 8, -2})},
+    {"10_57", 10, true, 79, symmetricAlexander({2, -8, 18, -23, 18, -8, 2})},
+    {"10_58", 10, true, 65, symmetricAlexander({3, -16, 27, -16, 3})},
+    {"10_59", 10, true, 75, symmetricAlexander({1, -7, 18, -23, 18, -7, 1})},
+    {"10_60", 10, true, 85, symmetricAlexander({-2, 9, -19, 25, -19, 9, -2})},
+    {"10_61", 10, true, 33, symmetricAlexander({-2, 5, -6, 7, -6, 5, -2})},
+    {"10_62", 10, true, 45, symmetricAlexander({1, -3, 6, -8, 9, -8, 6, -3, 1})},
+    {"10_63", 10, true, 57, symmetricAlexander({5, -14, 19, -14, 5})},
+    {"10_64", 10, true, 51, symmetricAlexander({-1, 3, -6, 10, -11, 10, -6, 3, -1})},
+    {"10_65", 10, true, 63, symmetricAlexander({-1, 4, -8, 12, -13, 12, -8, 4, -1})},
+    {"10_66", 10, true, 75, symmetricAlexander({3, -9, 16, -19, 16, -9, 3})},
+    {"10_67", 10, true, 63, symmetricAlexander({-4, 16, -23, 16, -4})},
+    {"10_68", 10, true, 57, symmetricAlexander({-2, 7, -12, 15, -12, 7, -2})},
+    {"10_69", 10, true, 87, symmetricAlexander({-1, 5, -11, 17, -19, 17, -11, 5, -1})},
+    {"10_70", 10, true, 67, symmetricAlexander({2, -8, 15, -17, 15, -8, 2})},
+    {"10_71", 10, true, 77, symmetricAlexander({-2, 8, -17, 23, -17, 8, -2})},
+    {"10_72", 10, true, 73, symmetricAlexander({-2, 8, -16, 21, -16, 8, -2})},
+    {"10_73", 10, true, 83, symmetricAlexander({1, -8, 20, -25, 20, -8, 1})},
+    {"10_74", 10, true, 63, symmetricAlexander({-4, 16, -23, 16, -4})},
+    {"10_75", 10, true, 81, symmetricAlexander({-2, 9, -18, 23, -18, 9, -2})},
+    {"10_76", 10, true, 57, symmetricAlexander({1, -4, 8, -10, 11, -10, 8, -4, 1})},
+    {"10_77", 10, true, 63, symmetricAlexander({2, -8, 14, -15, 14, -8, 2})},
+    {"10_78", 10, true, 69, symmetricAlexander({-1, 7, -16, 21, -16, 7, -1})},
+    {"10_79", 10, true, 61, symmetricAlexander({1, -3, 7, -12, 15, -12, 7, -3, 1})},
+    {"10_80", 10, true, 71, symmetricAlexander({3, -9, 15, -17, 15, -9, 3})},
+    {"10_81", 10, true, 85, symmetricAlexander({-1, 7, -20, 29, -20, 7, -1})},
+    {"10_82", 10, true, 63, symmetricAlexander({2, -7, 14, -17, 14, -7, 2})},
+    {"10_83", 10, true, 83, symmetricAlexander({1, -7, 20, -27, 20, -7, 1})},
+    {"10_84", 10, true, 87, symmetricAlexander({1, -7, 21, -29, 21, -7, 1})},
+    {"10_85", 10, true, 57, symmetricAlexander({4, -14, 21, -14, 4})},
+    {"10_86", 10, true, 85, symmetricAlexander({-1, 8, -20, 27, -20, 8, -1})},
+    {"10_87", 10, true, 73, symmetricAlexander({-2, 9, -16, 19, -16, 9, -2})},
+    {"10_88", 10, true, 101, symmetricAlexander({-2, 10, -23, 31, -23, 10, -2})},
+    {"10_89", 10, true, 99, symmetricAlexander({1, -8, 24, -33, 24, -8, 1})},
+    {"10_90", 10, true, 77, symmetricAlexander({-2, 9, -17, 21, -17, 9, -2})},
+    {"10_91", 10, true, 75, symmetricAlexander({-1, 4, -9, 15, -17, 15, -9, 4, -1})},
+    {"10_92", 10, true, 89, symmetricAlexander({-2, 10, -20, 25, -20, 10, -2})},
+    {"10_93", 10, true, 67, symmetricAlexander({2, -7, 15, -19, 15, -7, 2})},
+    {"10_94", 10, true, 71, symmetricAlexander({-1, 4, -9, 14, -15, 14, -9, 4, -1})},
+    {"10_95", 10, true, 91, symmetricAlexander({1, -8, 22, -29, 22, -8, 1})},
+    {"10_96", 10, true, 93, symmetricAlexander({-2, 10, -21, 27, -21, 10, -2})},
+    {"10_97", 10, true, 87, symmetricAlexander({-5, 22, -33, 22, -5})},
+    {"10_98", 10, true, 81, symmetricAlexander({-2, 9, -18, 23, -18, 9, -2})},
+    {"10_99", 10, true, 81, symmetricAlexander({1, -4, 10, -16, 19, -16, 10, -4, 1})},
+    {"10_100", 10, true, 65, symmetricAlexander({1, -4, 9, -12, 13, -12, 9, -4, 1})},
+    {"10_101", 10, true, 85, symmetricAlexander({7, -21, 29, -21, 7})},
+    {"10_102", 10, true, 73, symmetricAlexander({1, -4, 9, -14, 17, -14, 9, -4, 1})},
+    {"10_103", 10, true, 75, symmetricAlexander({2, -8, 17, -21, 17, -8, 2})},
+    {"10_104", 10, true, 77, symmetricAlexander({-1, 7, -18, 25, -18, 7, -1})},
+    {"10_105", 10, true, 91, symmetricAlexander({2, -9, 21, -27, 21, -9, 2})},
+    {"10_106", 10, true, 75, symmetricAlexander({1, -7, 18, -23, 18, -7, 1})},
+    {"10_107", 10, true, 87, symmetricAlexander({2, -9, 20, -25, 20, -9, 2})},
+    {"10_108", 10, true, 63, symmetricAlexander({2, -7, 14, -17, 14, -7, 2})},
+    {"10_109", 10, true, 85, symmetricAlexander({1, -4, 10, -17, 21, -17, 10, -4, 1})},
+    {"10_110", 10, true, 83, symmetricAlexander({2, -9, 19, -23, 19, -9, 2})},
+    {"10_111", 10, true, 77, symmetricAlexander({1, -4, 9, -15, 19, -15, 9, -4, 1})},
+    {"10_112", 10, true, 93, symmetricAlexander({-1, 7, -22, 33, -22, 7, -1})},
+    {"10_113", 10, true, 111, symmetricAlexander({2, -11, 26, -33, 26, -11, 2})},
+    {"10_114", 10, true, 93, symmetricAlexander({-1, 8, -22, 31, -22, 8, -1})},
+    {"10_115", 10, true, 109, symmetricAlexander({-1, 9, -26, 37, -26, 9, -1})},
+    {"10_116", 10, true, 103, symmetricAlexander({2, -10, 24, -31, 24, -10, 2})},
+    {"10_117", 10, true, 97, symmetricAlexander({1, -5, 12, -19, 23, -19, 12, -5, 1})},
+    {"10_118", 10, true, 95, symmetricAlexander({-1, 5, -12, 19, -21, 19, -12, 5, -1})},
+    {"10_119", 10, true, 101, symmetricAlexander({-1, 8, -24, 35, -24, 8, -1})},
+    {"10_120", 10, true, 105, symmetricAlexander({8, -26, 37, -26, 8})},
+    {"10_121", 10, true, 115, symmetricAlexander({2, -11, 27, -35, 27, -11, 2})},
+    {"10_122", 10, true, 105, symmetricAlexander({-2, 11, -24, 31, -24, 11, -2})},
+    {"10_123", 10, true, 121, symmetricAlexander({1, -6, 15, -24, 29, -24, 15, -6, 1})},
+    {"10_124", 10, false, 1, symmetricAlexander({1, -1, 0, 1, -1, 1, 0, -1, 1})},
+    {"10_125", 10, false, 11, symmetricAlexander({1, -2, 2, -1, 2, -2, 1})},
+    {"10_126", 10, false, 19, symmetricAlexander({1, -2, 4, -5, 4, -2, 1})},
+    {"10_127", 10, false, 29, symmetricAlexander({-1, 4, -6, 7, -6, 4, -1})},
+    {"10_128", 10, false, 11, symmetricAlexander({2, -3, 1, 1, 1, -3, 2})},
+    {"10_129", 10, false, 25, symmetricAlexander({2, -6, 9, -6, 2})},
+    {"10_130", 10, false, 17, symmetricAlexander({2, -4, 5, -4, 2})},
+    {"10_131", 10, false, 31, symmetricAlexander({-2, 8, -11, 8, -2})},
+    {"10_132", 10, false, 5, symmetricAlexander({1, -1, 1, -1, 1})},
+    {"10_133", 10, false, 19, symmetricAlexander({-1, 5, -7, 5, -1})},
+    {"10_134", 10, false, 23, symmetricAlexander({2, -4, 4, -3, 4, -4, 2})},
+    {"10_135", 10, false, 37, symmetricAlexander({3, -9, 13, -9, 3})},
+    {"10_136", 10, false, 15, symmetricAlexander({-1, 4, -5, 4, -1})},
+    {"10_137", 10, false, 25, symmetricAlexander({1, -6, 11, -6, 1})},
+    {"10_138", 10, false, 35, symmetricAlexander({1, -5, 8, -7, 8, -5, 1})},
+    {"10_139", 10, false, 3, symmetricAlexander({1, -1, 0, 2, -3, 2, 0, -1, 1})},
+    {"10_140", 10, false, 9, symmetricAlexander({1, -2, 3, -2, 1})},
+    {"10_141", 10, false, 21, symmetricAlexander({-1, 4, -4, 3, -4, 4, -1})},
+    {"10_142", 10, false, 15, symmetricAlexander({2, -3, 2, -1, 2, -3, 2})},
+    {"10_143", 10, false, 27, symmetricAlexander({1, -3, 6, -7, 6, -3, 1})},
+    {"10_144", 10, false, 39, symmetricAlexander({-3, 10, -13, 10, -3})},
+    {"10_145", 10, false, 3, symmetricAlexander({1, 1, -3, 1, 1})},
+    {"10_146", 10, false, 33, symmetricAlexander({2, -8, 13, -8, 2})},
+    {"10_147", 10, false, 27, symmetricAlexander({-2, 7, -9, 7, -2})},
+    {"10_148", 10, false, 31, symmetricAlexander({1, -3, 7, -9, 7, -3, 1})},
+    {"10_149", 10, false, 41, symmetricAlexander({-1, 5, -9, 11, -9, 5, -1})},
+    {"10_150", 10, false, 29, symmetricAlexander({2, -7, 11, -7, 2})},
+    {"10_151", 10, false, 43, symmetricAlexander({1, -4, 10, -13, 10, -4, 1})},
+    {"10_152", 10, false, 11, symmetricAlexander({1, -1, -1, 4, -5, 4, -1, -1, 1})},
+    {"10_153", 10, false, 1, symmetricAlexander({1, -1, -1, 3, -1, -1, 1})},
+    {"10_154", 10, false, 13, symmetricAlexander({1, 0, -4, 7, -4, 0, 1})},
+    {"10_155", 10, false, 25, symmetricAlexander({-1, 3, -5, 7, -5, 3, -1})},
+    {"10_156", 10, false, 35, symmetricAlexander({1, -4, 8, -9, 8, -4, 1})},
+    {"10_157", 10, false, 49, symmetricAlexander({-1, 6, -11, 13, -11, 6, -1})},
+    {"10_158", 10, false, 45, symmetricAlexander({-1, 4, -10, 15, -10, 4, -1})},
+    {"10_159", 10, false, 39, symmetricAlexander({1, -5, 9, -9, 9, -5, 1})},
+    {"10_160", 10, false, 21, symmetricAlexander({2, -5, 7, -5, 2})},
+    {"10_161", 10, false, 5, symmetricAlexander({1, 0, -2, 3, -2, 0, 1})},
+    {"10_162", 10, false, 35, symmetricAlexander({-2, 9, -13, 9, -2})},
+    {"10_163", 10, false, 51, symmetricAlexander({-3, 13, -19, 13, -3})},
+    {"10_164", 10, false, 45, symmetricAlexander({3, -11, 17, -11, 3})},
+    {"10_165", 10, false, 39, symmetricAlexander({-2, 10, -15, 10, -2})},
+}};
+
+/*
+    @brief Entry of a knot by name, nullptr when it isn't in the table.
+*/
+constexpr const KnotTableEntry *findKnot(std::string_view name)
+{
+    for (const KnotTableEntry &entry : KNOT_TABLE)
+    {
+        if (entry.name == name)
+            return &entry;
+    }
+    return nullptr;
+}
+
+/*
+    @brief Checks an entry against itself: symmetric, Delta(1) = 1, |Delta(-1)| = determinant.
+*/
+constexpr bool isConsistentEntry(const KnotTableEntry &entry)
+{
+    const AlexanderPolynomial &alexander = entry.alexander;
+    if (alexander.getTrailingDegree() != -alexander.getLeadingDegree() || alexander.evaluate(1) != 1)
+        return false;
+
+    for (DEGREE_TYPE k = 1; k <= alexander.getLeadingDegree(); k++)
+    {
+        if (alexander.getCoefficient(k) != alexander.getCoefficient(-k))
+            return false;
+    }
+
+    const double atMinusOne = alexander.evaluate(-1);
+    return (atMinusOne < 0 ? -atMinusOne : atMinusOne) == entry.determinant;
+}
+
+constexpr bool isConsistentTable()
+{
+    for (const KnotTableEntry &entry : KNOT_TABLE)
+    {
+        if (!isConsistentEntry(entry))
+            return false;
+    }
+    return true;
+}
+
+static_assert(isConsistentTable(), "a KNOT_TABLE entry is not a symmetric, normalized Alexander polynomial of its determinant");
+static_assert(secondConwayCoefficient(findKnot("3_1")->alexander) == 1 && secondConwayCoefficient(findKnot("4_1")->alexander) == -1);
+static_assert(secondConwayCoefficient(findKnot("8_19")->alexander) == 5, "8_19 is the (3, 4) torus knot");
+
+// the Alexander polynomial and the determinant are multiplicative under connected sum
+static_assert((findKnot("3_1")->alexander * findKnot("3_1")->alexander).evaluate(-1) == 9);
+static_assert(findKnot("3_1")->alexander * findKnot("4_1")->alexander == findKnot("8_21")->alexander, "3_1 # 4_1 and 8_21 share their Alexander polynomial");
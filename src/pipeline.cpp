@@ -0,0 +1,218 @@
+#include "pipeline.hpp"
+#include "boundedQueue.hpp"
+#include "exception.hpp"
+#include "gaussDiagram.hpp"
+#include <cstdlib>
+#include <sstream>
+
+namespace
+{
+/*
+    Unit of work passed between the stages. A record with last set closes the stream.
+*/
+struct PipelineRecord
+{
+    uint64_t line = 0;
+    bool last = false;
+    std::string name;
+    std::string error;
+
+    Knot knot;
+    size_t crossings = 0;
+    uint64_t determinant = 0;
+    bool determinantOverflow = false;
+    int64_t v2 = 0, v3 = 0;
+};
+}
+
+/*
+    @param queueCapacity Capacity of each of the three queues between the stages.
+    @param invariantThreads Threads computing the invariants, the slowest stage.
+*/
+KnotPipeline::KnotPipeline(size_t queueCapacity, unsigned invariantThreads)
+    : _queueCapacity(queueCapacity), _invariantThreads(std::max(1u, invariantThreads))
+{
+}
+
+/*
+    @brief Processes every record of @p input and writes one result line per record to @p output.
+    A record that can't be parsed, isn't a single planar component or fails in a later
+    stage is written as an error line, the run goes on.
+*/
+PipelineStats KnotPipeline::run(std::istream &input, std::ostream &output) const
+{
+    BoundedQueue<PipelineRecord> parsed(_queueCapacity), reduced(_queueCapacity), evaluated(_queueCapacity);
+    PipelineStats stats;
+
+    // parse and validate
+    std::thread reader([&]()
+    {
+        std::string line;
+        for (uint64_t lineNumber = 1; std::getline(input, line); lineNumber++)
+        {
+            const size_t start = line.find_first_not_of(" \t\r");
+            if (start == std::string::npos || line[start] == '#')
+                continue;
+
+            PipelineRecord record;
+            record.line = lineNumber;
+            try
+            {
+                std::vector<crossing> planarDiagram = parseRecord(line, record.name);
+                relabelPlanarDiagram(planarDiagram);
+                record.knot = Knot(planarDiagram);
+                record.crossings = planarDiagram.size();
+                if (!record.knot.isPlanar())
+                    record.error = "the planar diagram can't be drawn in the plane.";
+            }
+            catch (const kle::KnotlibExceptions &e)
+            {
+                record.error = e.what();
+            }
+            parsed.push(std::move(record));
+        }
+
+        PipelineRecord end;
+        end.last = true;
+        parsed.push(std::move(end));
+    });
+
+    // simplify, then fan out to the invariant threads
+    std::thread reducer([&]()
+    {
+        for (PipelineRecord record = parsed.pop(); !record.last; record = parsed.pop())
+        {
+            if (record.error.empty())
+            {
+                try
+                {
+                    record.knot.reduce();
+                }
+                catch (const kle::KnotlibExceptions &e)
+                {
+                    record.error = e.what();
+                }
+            }
+            reduced.push(std::move(record));
+        }
+
+        for (unsigned i = 0; i < _invariantThreads; i++)
+        {
+            PipelineRecord end;
+            end.last = true;
+            reduced.push(std::move(end));
+        }
+    });
+
+    std::vector<std::thread> evaluators;
+    for (unsigned i = 0; i < _invariantThreads; i++)
+    {
+        evaluators.emplace_back([&]()
+        {
+            for (PipelineRecord record = reduced.pop(); !record.last; record = reduced.pop())
+            {
+                if (record.error.empty())
+                {
+                    try
+                    {
+                        const GaussDiagram gauss(record.knot);
+                        try
+                        {
+                            record.determinant = record.knot.determinant();
+                        }
+                        catch (const kle::InvariantOverflowException &)
+                        {
+                            // the exact value doesn't fit, the other invariants are still written
+                            record.determinantOverflow = true;
+                        }
+                        record.v2 = gauss.v2();
+                        record.v3 = gauss.v3();
+                    }
+                    catch (const kle::KnotlibExceptions &e)
+                    {
+                        record.error = e.what();
+                    }
+                }
+                evaluated.push(std::move(record));
+            }
+
+            PipelineRecord end;
+            end.last = true;
+            evaluated.push(std::move(end));
+        });
+    }
+
+    // serialize on the calling thread
+    for (unsigned running = _invariantThreads; running > 0;)
+    {
+        PipelineRecord record = evaluated.pop();
+        if (record.last)
+        {
+            running--;
+            continue;
+        }
+
+        stats.records++;
+        output << record.line << "\t" << record.name << "\t";
+        if (!record.error.empty())
+        {
+            stats.rejected++;
+            output << "error\t" << record.error << "\n";
+        }
+        else
+        {
+            output << record.crossings << "\t" << record.knot.getPlanarDiagram().size() << "\t";
+            if (record.determinantOverflow)
+                output << "overflow";
+            else
+                output << record.determinant;
+            output << "\t" << record.v2 << "\t" << record.v3 << "\n";
+        }
+    }
+
+    reader.join();
+    reducer.join();
+    for (std::thread &evaluator : evaluators)
+        evaluator.join();
+    output.flush();
+
+    return stats;
+}
+
+/*
+    @brief Reads one input line, see KnotPipeline.
+    @param name Set to the first field.
+    @throws MalformedRecordException if the crossings are not groups of 4 arcs and a sign.
+*/
+std::vector<crossing> KnotPipeline::parseRecord(const std::string &line, std::string &name)
+{
+    std::istringstream fields(line);
+    if (!(fields >> name))
+        throw kle::MalformedRecordException("empty record.");
+
+    std::vector<crossing> planarDiagram;
+    std::string field;
+    uint16_t arcs[4];
+    size_t count = 0;
+    while (fields >> field)
+    {
+        if (count == 4)
+        {
+            if (field != "+" && field != "-")
+                throw kle::MalformedRecordException(name + ": expected + or - after 4 arcs, got '" + field + "'.");
+            planarDiagram.emplace_back(arcs[0], arcs[1], arcs[2], arcs[3], field == "+");
+            count = 0;
+            continue;
+        }
+
+        char *end = nullptr;
+        const unsigned long arc = std::strtoul(field.c_str(), &end, 10);
+        if (*end != '\0' || field[0] == '-' || arc == 0 || arc > UINT16_MAX)
+            throw kle::MalformedRecordException(name + ": '" + field + "' is not an arc label.");
+        arcs[count++] = arc;
+    }
+
+    if (count != 0)
+        throw kle::MalformedRecordException(name + ": the last crossing is incomplete.");
+    return planarDiagram;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "knot.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Counters of a pipeline run.
+ */
+struct PipelineStats
+{
+    uint64_t records = 0;
+    uint64_t rejected = 0;
+};
+
+/**
+ * @class KnotPipeline
+ * @brief Streams planar diagram records through parse/validate -> reduce -> invariants -> write.
+ *
+ * Every stage runs on its own thread(s) and hands records to the next one through a
+ * BoundedQueue, a stage that gets ahead blocks on the full queue of the next one. At most
+ * about 3 * queueCapacity + invariantThreads records are alive at once, whatever the size
+ * of the input.
+ *
+ * Input: one knot per line, a name followed by 5 fields per crossing,
+ *     name over_in under_out over_out under_in sign ...
+ * with sign + or -. Blank lines and lines starting with # are skipped, arcs may use any
+ * labels as long as the diagram is a single planar component.
+ *
+ * Output: one tab separated line per record, in completion order (the input line number
+ * comes first),
+ *     line name crossings reducedCrossings determinant v2 v3
+ * where determinant is exact, or overflow when it doesn't fit on 64 bits, or, for a rejected
+ * record,
+ *     line name error message
+ */
+class KnotPipeline
+{
+public:
+    explicit KnotPipeline(size_t queueCapacity = 256, unsigned invariantThreads = std::max(1u, std::thread::hardware_concurrency() / 2));
+
+    PipelineStats run(std::istream &input, std::ostream &output) const;
+
+    static std::vector<crossing> parseRecord(const std::string &line, std::string &name);
+
+private:
+    size_t _queueCapacity;
+    unsigned _invariantThreads;
+};
@@ -0,0 +1,452 @@
+#include "presentation.hpp"
+#include "exception.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// residues are below 2^24 so sums of 16 products of two of them stay exact in a double
+constexpr uint32_t PRIME_LIMIT = 1u << 24;
+constexpr size_t EXACT_PRODUCTS = 16;
+
+/*
+    @brief Primes of [2^24 - 2^17, 2^24) from the largest down, sieved once.
+*/
+const std::vector<uint32_t> &primes()
+{
+    static const std::vector<uint32_t> table = []()
+    {
+        constexpr uint32_t window = 1u << 17, low = PRIME_LIMIT - window;
+        std::vector<bool> composite(window, false);
+        for (uint32_t d = 2; d * d < PRIME_LIMIT; d++)
+        {
+            for (uint32_t multiple = (low + d - 1) / d * d; multiple < PRIME_LIMIT; multiple += d)
+                composite[multiple - low] = true;
+        }
+
+        std::vector<uint32_t> found;
+        for (uint32_t i = window; i-- > 0;)
+        {
+            if (!composite[i])
+                found.push_back(low + i);
+        }
+        return found;
+    }();
+    return table;
+}
+
+double reduce(double x, double prime)
+{
+    double r = x - prime * std::floor(x / prime);
+    if (r < 0)
+        r += prime;
+    else if (r >= prime)
+        r -= prime;
+    return r;
+}
+
+void reduce(arma::mat &matrix, double prime)
+{
+    for (double &x : matrix)
+        x = reduce(x, prime);
+}
+
+double inverseModulo(double a, double prime)
+{
+    // Fermat, every intermediate product is below 2^48
+    uint64_t result = 1, base = (uint64_t)a, p = (uint64_t)prime;
+    for (uint64_t e = p - 2; e > 0; e >>= 1)
+    {
+        if (e & 1)
+            result = result * base % p;
+        base = base * base % p;
+    }
+    return (double)result;
+}
+
+/*
+    @brief left * right modulo a prime, both with entries in [0, prime).
+    The inner dimension is cut in blocks short enough for the products to stay exact.
+*/
+arma::mat multiplyModulo(const arma::mat &left, const arma::mat &right, double prime)
+{
+    arma::mat product(left.n_rows, right.n_cols, arma::fill::zeros);
+    for (size_t start = 0; start < left.n_cols; start += EXACT_PRODUCTS)
+    {
+        const size_t end = std::min<size_t>(start + EXACT_PRODUCTS, left.n_cols) - 1;
+        product += left.cols(start, end) * right.rows(start, end);
+        reduce(product, prime);
+    }
+    return product;
+}
+
+/*
+    @brief Gauss-Jordan inversion modulo a prime.
+    @param matrix Square matrix of integers, of any sign.
+    @return False when the matrix is singular modulo @p prime.
+    The rows are only reduced every EXACT_PRODUCTS pivots, in between an entry grows by less
+    than prime^2 per pivot and stays an exact integer.
+*/
+bool invertModulo(const arma::mat &matrix, double prime, arma::mat &inverse, double &determinant)
+{
+    const size_t m = matrix.n_rows;
+    determinant = 1;
+    if (m == 0)
+    {
+        inverse.reset();
+        return true;
+    }
+
+    arma::mat work = arma::join_rows(matrix, arma::eye<arma::mat>(m, m));
+    reduce(work, prime);
+
+    std::vector<double> factors(m);
+    for (size_t k = 0; k < m; k++)
+    {
+        for (size_t i = 0; i < m; i++)
+            work(i, k) = reduce(work(i, k), prime);
+
+        size_t pivot = k;
+        while (pivot < m && work(pivot, k) == 0)
+            pivot++;
+        if (pivot == m)
+            return false;
+        if (pivot != k)
+        {
+            work.swap_rows(pivot, k);
+            determinant = prime - determinant;
+        }
+
+        determinant = reduce(determinant * work(k, k), prime);
+        const double scale = inverseModulo(work(k, k), prime);
+        for (size_t j = k; j < 2 * m; j++)
+            work(k, j) = reduce(reduce(work(k, j), prime) * scale, prime);
+
+        for (size_t i = 0; i < m; i++)
+            factors[i] = (i == k) ? 0 : work(i, k);
+        for (size_t j = k + 1; j < 2 * m; j++)
+        {
+            const double u = work(k, j);
+            if (u == 0)
+                continue;
+
+            double *column = work.colptr(j);
+            for (size_t i = 0; i < m; i++)
+                column[i] -= factors[i] * u;
+        }
+        work.col(k).zeros();
+        work(k, k) = 1;
+
+        if ((k + 1) % EXACT_PRODUCTS == 0)
+            reduce(work, prime);
+    }
+
+    reduce(work, prime);
+    inverse = work.cols(m, 2 * m - 1);
+    return true;
+}
+
+/*
+    @brief Bound on log2 |det| from the lengths of the rows.
+*/
+double hadamardBits(const arma::mat &matrix)
+{
+    double bits = 0;
+    for (size_t i = 0; i < matrix.n_rows; i++)
+    {
+        double squares = 0;
+        for (size_t j = 0; j < matrix.n_cols; j++)
+            squares += matrix(i, j) * matrix(i, j);
+        bits += 0.5 * std::log2(squares);
+    }
+    return bits;
+}
+
+/*
+    @brief Indices of [0, size) missing from @p indices, in increasing order.
+*/
+arma::uvec complement(const arma::uvec &indices, size_t size)
+{
+    std::vector<bool> listed(size, false);
+    for (size_t i = 0; i < indices.n_elem; i++)
+        listed[indices(i)] = true;
+
+    arma::uvec missing(size - indices.n_elem);
+    for (size_t i = 0, k = 0; i < size; i++)
+    {
+        if (!listed[i])
+            missing(k++) = i;
+    }
+    return missing;
+}
+
+/*
+    @brief Sign of a permutation of [0, n), from the parity of its cycles.
+*/
+double permutationSign(const arma::uvec &order)
+{
+    std::vector<bool> seen(order.n_elem, false);
+    double sign = 1;
+    for (size_t start = 0; start < order.n_elem; start++)
+    {
+        for (size_t i = order(start); !seen[start] && i != start; i = order(i))
+        {
+            seen[i] = true;
+            sign = -sign;
+        }
+        seen[start] = true;
+    }
+    return sign;
+}
+}
+
+PresentationFactorization::PresentationFactorization()
+    : _determinantBits(std::numeric_limits<double>::infinity()), _primesUsed(0) {}
+
+PresentationFactorization::PresentationFactorization(const arma::mat &matrix, double determinantBits)
+    : PresentationFactorization()
+{
+    factor(matrix, determinantBits);
+}
+
+/**
+ * @brief Factors a new matrix from scratch.
+ * @param matrix A square non singular matrix of integers.
+ * @param determinantBits Bound on log2 |det| of this matrix and of every matrix it is updated
+ * to, Hadamard's bound is used when it is lower.
+ * @throws SingularPresentationMatrix if the matrix can't be inverted.
+ */
+void PresentationFactorization::factor(const arma::mat &matrix, double determinantBits)
+{
+    if (matrix.n_rows != matrix.n_cols)
+        throw kle::SingularPresentationMatrix("a presentation matrix must be square to be factored.");
+
+    _matrix = matrix;
+    _determinantBits = determinantBits;
+    _residues.clear();
+    _primesUsed = 0;
+    addResidues(0);
+}
+
+/**
+ * @brief Replaces rows of the matrix and updates the factorization.
+ * @param rows Indices of the replaced rows, without duplicates.
+ * @param newRows One row of integers per index of @p rows.
+ * @throws SingularPresentationMatrix if the new matrix can't be inverted.
+ */
+void PresentationFactorization::updateRows(const arma::uvec &rows, const arma::mat &newRows)
+{
+    const arma::mat delta = newRows - _matrix.rows(rows);
+    _matrix.rows(rows) = newRows;
+
+    double failedBits = 0;
+    for (size_t r = _residues.size(); r-- > 0;)
+    {
+        Residue &residue = _residues[r];
+        const double prime = residue.prime;
+        arma::mat reducedDelta = delta;
+        reduce(reducedDelta, prime);
+
+        // det(A + E D) = det(A) det(I + D A^-1 E) where E selects the replaced rows
+        const arma::mat product = multiplyModulo(reducedDelta, residue.inverse, prime);
+        arma::mat capacitance = product.cols(rows) + arma::eye<arma::mat>(rows.n_elem, rows.n_elem);
+        arma::mat capacitanceInverse;
+        double ratio;
+        if (!invertModulo(capacitance, prime, capacitanceInverse, ratio))
+        {
+            // the prime divides the new determinant, another one takes its place
+            failedBits += std::log2(prime);
+            _residues.erase(_residues.begin() + r);
+            continue;
+        }
+
+        // (A + E D)^-1 = A^-1 - A^-1 E (I + D A^-1 E)^-1 D A^-1
+        const arma::mat correction = multiplyModulo(capacitanceInverse, product, prime);
+        residue.inverse -= multiplyModulo(residue.inverse.cols(rows), correction, prime);
+        reduce(residue.inverse, prime);
+        residue.determinant = reduce(residue.determinant * ratio, prime);
+    }
+    addResidues(failedBits);
+}
+
+/**
+ * @brief Adds a column of the matrix to another one, the determinant doesn't change.
+ * @param source Index of the added column.
+ * @param target Index of the column it is added to, different from @p source.
+ */
+void PresentationFactorization::addColumn(size_t source, size_t target)
+{
+    for (size_t i = 0; i < _matrix.n_rows; i++)
+        _matrix(i, target) += _matrix(i, source);
+
+    // A (I + e_s e_t^T) has the inverse (I - e_s e_t^T) A^-1
+    for (Residue &residue : _residues)
+    {
+        for (size_t j = 0; j < _matrix.n_cols; j++)
+            residue.inverse(source, j) = reduce(residue.inverse(source, j) - residue.inverse(target, j), residue.prime);
+    }
+}
+
+/**
+ * @brief Changes the sign of a column of the matrix.
+ */
+void PresentationFactorization::negateColumn(size_t column)
+{
+    for (size_t i = 0; i < _matrix.n_rows; i++)
+        _matrix(i, column) = -_matrix(i, column);
+
+    for (Residue &residue : _residues)
+    {
+        for (size_t j = 0; j < _matrix.n_cols; j++)
+            residue.inverse(column, j) = reduce(-residue.inverse(column, j), residue.prime);
+        residue.determinant = reduce(-residue.determinant, residue.prime);
+    }
+}
+
+/**
+ * @brief Removes as many rows as columns of the matrix and updates the factorization.
+ * @param rows Indices of the removed rows, increasing.
+ * @param columns Indices of the removed columns, increasing.
+ * @throws SingularPresentationMatrix if the remaining matrix can't be inverted.
+ * When the remaining matrix is small enough to be factored in less time than the update
+ * takes, it is factored anew.
+ */
+void PresentationFactorization::removeRowsAndColumns(const arma::uvec &rows, const arma::uvec &columns)
+{
+    if (rows.n_elem != columns.n_elem)
+        throw kle::SingularPresentationMatrix("as many rows as columns must be removed from a presentation matrix.");
+
+    const size_t size = _matrix.n_rows, remaining = size - rows.n_elem;
+    const arma::uvec keptRows = complement(rows, size), keptColumns = complement(columns, size);
+    const arma::mat matrix = _matrix.submat(keptRows, keptColumns);
+    if (rows.n_elem * size * size > remaining * remaining * remaining)
+    {
+        factor(matrix, _determinantBits);
+        return;
+    }
+    _matrix = matrix;
+
+    // Jacobi: det A[~R, ~C] = (-1)^(sum R + sum C) det A det A^-1[C, R]
+    double sign = 1;
+    for (size_t i = 0; i < rows.n_elem; i++)
+    {
+        if ((rows(i) + columns(i)) % 2 == 1)
+            sign = -sign;
+    }
+
+    double failedBits = 0;
+    for (size_t r = _residues.size(); r-- > 0;)
+    {
+        Residue &residue = _residues[r];
+        const double prime = residue.prime;
+        arma::mat pivotInverse;
+        double pivotDeterminant;
+        if (!invertModulo(residue.inverse.submat(columns, rows), prime, pivotInverse, pivotDeterminant))
+        {
+            failedBits += std::log2(prime);
+            _residues.erase(_residues.begin() + r);
+            continue;
+        }
+
+        // the inverse of A[~R, ~C] is the Schur complement of A^-1[C, R] in A^-1
+        const arma::mat correction = multiplyModulo(pivotInverse, residue.inverse.submat(columns, keptRows), prime);
+        arma::mat inverse = residue.inverse.submat(keptColumns, keptRows);
+        inverse -= multiplyModulo(residue.inverse.submat(keptColumns, rows), correction, prime);
+        reduce(inverse, prime);
+        residue.inverse = inverse;
+        residue.determinant = reduce(sign * residue.determinant * pivotDeterminant, prime);
+    }
+    addResidues(failedBits);
+}
+
+/**
+ * @brief Reorders the columns of the matrix.
+ * @param order Column @p order(j) becomes column j.
+ */
+void PresentationFactorization::permuteColumns(const arma::uvec &order)
+{
+    _matrix = _matrix.cols(order);
+
+    const double sign = permutationSign(order);
+    for (Residue &residue : _residues)
+    {
+        residue.inverse = residue.inverse.rows(order);
+        residue.determinant = reduce(sign * residue.determinant, residue.prime);
+    }
+}
+
+/**
+ * @brief |det| of the current matrix, exact.
+ * @throws InvariantOverflowException if it doesn't fit on 64 bits.
+ * The residues determine det modulo their product P > 2^64 + 2^bound, so at most one of
+ * det mod P and -det mod P is below 2^64 and when one is, it is |det|.
+ */
+uint64_t PresentationFactorization::absoluteDeterminant() const
+{
+    for (double sign : {1.0, -1.0})
+    {
+        // Garner's mixed radix digits of the representative in [0, P)
+        std::vector<uint64_t> digits;
+        unsigned __int128 value = 0, radix = 1;
+        bool fits = true;
+        for (const Residue &residue : _residues)
+        {
+            const uint64_t prime = (uint64_t)residue.prime;
+            uint64_t partial = 0, product = 1;
+            for (size_t j = 0; j < digits.size(); j++)
+            {
+                partial = (partial + digits[j] * product) % prime;
+                product = product * ((uint64_t)_residues[j].prime % prime) % prime;
+            }
+
+            const uint64_t target = (uint64_t)reduce(sign * residue.determinant, residue.prime);
+            const uint64_t digit = (target + prime - partial) % prime * (uint64_t)inverseModulo((double)product, residue.prime) % prime;
+            digits.push_back(digit);
+
+            if (digit != 0)
+            {
+                fits = fits && radix <= UINT64_MAX;
+                value += fits ? (unsigned __int128)digit * radix : 0;
+                fits = fits && value <= UINT64_MAX;
+            }
+            radix = std::min<unsigned __int128>(radix * prime, (unsigned __int128)UINT64_MAX + 1);
+        }
+
+        if (fits)
+            return (uint64_t)value;
+    }
+    throw kle::InvariantOverflowException("the determinant doesn't fit on 64 bits.");
+}
+
+const arma::mat &PresentationFactorization::getMatrix() const { return _matrix; }
+bool PresentationFactorization::isEmpty() const { return _matrix.is_empty(); }
+
+/*
+    @brief Factors the matrix modulo new primes until their product is large enough.
+    @param failedBits log2 of the product of the primes already found to divide the determinant.
+    When primes dividing the determinant multiply past its bound, the determinant is 0.
+*/
+void PresentationFactorization::addResidues(double failedBits)
+{
+    const double bound = std::min(_determinantBits, hadamardBits(_matrix));
+    const double requiredBits = std::max(bound, 64.0) + 1;
+
+    double bits = 0;
+    for (const Residue &residue : _residues)
+        bits += std::log2(residue.prime);
+
+    while (bits < requiredBits)
+    {
+        if (_primesUsed == primes().size())
+            throw kle::InvariantOverflowException("the determinant bound needs more than " + std::to_string(primes().size()) + " primes.");
+
+        Residue residue{(double)primes()[_primesUsed++], arma::mat(), 0};
+        if (invertModulo(_matrix, residue.prime, residue.inverse, residue.determinant))
+        {
+            bits += std::log2(residue.prime);
+            _residues.push_back(std::move(residue));
+        }
+        else if ((failedBits += std::log2(residue.prime)) > bound)
+            throw kle::SingularPresentationMatrix("the presentation matrix is singular.");
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <armadillo>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * @class PresentationFactorization
+ * @brief Keeps the exact determinant and the inverse of a square integer presentation matrix
+ *        up to date while rows are replaced.
+ *
+ * The inverse and the determinant are kept modulo primes below 2^24, enough of them for their
+ * product to exceed 2^65 and twice a bound on |det| (Hadamard's, or a tighter one given by the
+ * caller), so the determinant is recovered exactly by the Chinese remainder theorem. Replacing
+ * k rows of an m x m matrix costs O(k m^2) per prime through the matrix determinant lemma and
+ * the Woodbury identity instead of the O(m^3) of a new factorization. Column operations cost
+ * O(m) and removing k rows and k columns O(k m^2) by Jacobi's complementary minor identity. The
+ * arithmetic is exact: nothing drifts and nothing is refactored, except for a prime dividing the
+ * determinant of an updated matrix, which is replaced by a new one, and removals that leave a
+ * matrix cheaper to factor than to update.
+ */
+class PresentationFactorization
+{
+public:
+    PresentationFactorization();
+    explicit PresentationFactorization(const arma::mat &matrix, double determinantBits = std::numeric_limits<double>::infinity());
+
+    void factor(const arma::mat &matrix, double determinantBits = std::numeric_limits<double>::infinity());
+    void updateRows(const arma::uvec &rows, const arma::mat &newRows);
+    void addColumn(size_t source, size_t target);
+    void negateColumn(size_t column);
+    void removeRowsAndColumns(const arma::uvec &rows, const arma::uvec &columns);
+    void permuteColumns(const arma::uvec &order);
+
+    // read only
+    uint64_t absoluteDeterminant() const;
+    const arma::mat &getMatrix() const;
+    bool isEmpty() const;
+
+private:
+    // inverse and determinant of the matrix modulo one prime, entries in [0, prime)
+    struct Residue
+    {
+        double prime;
+        arma::mat inverse;
+        double determinant;
+    };
+
+    arma::mat _matrix;
+    std::vector<Residue> _residues;
+    double _determinantBits;
+    size_t _primesUsed;
+
+    void addResidues(double failedBits);
+};
@@ -1,18 +1,36 @@
 #include <iostream>
 #include <cassert>
+#include <cstdio>
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <sstream>
+#include <thread>
 
 #define DEGREE_TYPE int
 
 #include "knot.hpp"
 #include "Polynomials.hpp"
+#include "diagramGenerator.hpp"
+#include "gaussDiagram.hpp"
+#include "enumerator.hpp"
+#include "boundedQueue.hpp"
+#include "pipeline.hpp"
+#include "knotTable.hpp"
 
 using namespace std;
 using namespace arma;
 
 // clang++ -std=c++14 src/tests.cpp -o main -I/opt/homebrew/include -L/opt/homebrew/lib -larmadillo
-// clang++ -std=c++20 src/tests.cpp src/Polynomials.cpp -I/opt/homebrew/include -L/opt/homebrew/lib -larmadillo -Wall
+// clang++ -std=c++20 src/tests.cpp src/Polynomials.cpp src/knot.cpp src/presentation.cpp src/diagramGenerator.cpp src/gaussDiagram.cpp src/enumerator.cpp src/pipeline.cpp -I/opt/homebrew/include -L/opt/homebrew/lib -larmadillo -Wall -pthread
 
 void runTests();
+void runDiagramGeneratorTests();
+void runKnotTests();
+void runGaussDiagramTests();
+void runEnumeratorTests();
+void runPipelineTests();
+void runKnotTableTests();
 void equalAsserts(vector<Term> poly1);
 void testPolySum(vector<Term> poly1, vector<Term> poly2, vector<Term> Expected);
 
@@ -28,6 +46,12 @@ int main()
 
     cout << "______________________________" << endl;
     runTests();
+    runDiagramGeneratorTests();
+    runKnotTests();
+    runGaussDiagramTests();
+    runEnumeratorTests();
+    runPipelineTests();
+    runKnotTableTests();
 
     return 0;
 }
@@ -182,6 +206,38 @@ void runTests()
 
     cout << endl << "polynomial operation Tests [PASSED]" << endl << endl<< endl;
 
+    // exact division and gcd, (t^2 - t + 1)(t - 2) and (t^2 - t + 1)(t^-1 + 3)
+    const Polynomial trefoil(vector<Term>{Term{1, -1}, Term{-1, 0}, Term{1, 1}}, -1, 1);
+    const Polynomial a(vector<Term>{Term{-2, 0}, Term{3, 1}, Term{-3, 2}, Term{1, 3}}, 0, 3);
+    const Polynomial b(vector<Term>{Term{1, -1}, Term{2, 0}, Term{-2, 1}, Term{3, 2}}, -1, 2);
+    const Polynomial t(vector<Term>{Term{1, 1}}, 1, 1);
+    assert(a / trefoil == Polynomial(vector<Term>{Term{-2, 1}, Term{1, 2}}, 1, 2));
+    assert((a * b) / b == a);
+
+    bool remainder = false;
+    try
+    {
+        a / b;
+    }
+    catch (const kle::PolynomialArithmeticException &)
+    {
+        remainder = true;
+    }
+    assert(remainder);
+
+    assert(Polynomial::gcd(a, b) == trefoil * t);
+    assert(Polynomial::gcd(a * 6.0, b * 4.0) == trefoil * t * 2.0);
+    assert(Polynomial::gcd(a, t * 5.0).isUnit());
+    assert(Polynomial::gcd(a, Polynomial()) == a);
+    assert(a.evaluate(1) == -1 && trefoil.evaluate(-1) == -3);
+
+    // arithmetic results keep every exponent of their range, scalar operations and == work on them
+    const Polynomial one(vector<Term>{Term{1, 0}}, 0, 0);
+    assert(trefoil + one == Polynomial(vector<Term>{Term{1, -1}, Term{0, 0}, Term{1, 1}}, -1, 1));
+    assert((trefoil + one) + 2.0 == Polynomial(vector<Term>{Term{1, -1}, Term{2, 0}, Term{1, 1}}, -1, 1));
+    assert((trefoil - trefoil) * 3.0 == Polynomial());
+    cout << endl << "division and gcd Tests [PASSED]" << endl << endl<< endl;
+
 
     cout << "_____________________________________________________________________________" << endl;
 }
@@ -214,3 +270,498 @@ void testPolySum(vector<Term> poly1, vector<Term> poly2, vector<Term> Expected)
     cout << "poly2 + poly1 = " << (Polynomial(poly2) + Polynomial(poly1)).toString() << endl;
     assert(sum == Polynomial(poly2) + Polynomial(poly1));
 }
+
+void runDiagramGeneratorTests()
+{
+    cout << "_____________________________________________________________________________" << endl;
+    cout << "___________________________[Diagram Generator Tests]________________________" << endl;
+    DiagramGenerator generator(2024);
+
+    // the trefoil as the closure of sigma_1^3
+    vector<crossing> trefoil{crossing(1, 5, 2, 4), crossing(5, 3, 6, 2), crossing(3, 1, 4, 6)};
+    Knot trefoilKnot(trefoil);
+
+    // braid closures are knots with at least length crossings
+    for (uint16_t strands = 1; strands < 8; strands++)
+    {
+        for (size_t length = 0; length < 40; length += 3)
+        {
+            vector<crossing> pd = generator.braidClosure(strands, length);
+            assert(pd.size() >= ((strands == 1) ? 0 : length));
+            assert(pd.size() <= length + strands - 1);
+            Knot braidKnot(pd); // throws if the diagram is inconsistent
+        }
+    }
+    assert(generator.braidClosure(1, 10).empty());
+
+    // the arc labels of the largest braids still fit on 16 bits: strands + 1 + 2 (length + strands - 1) <= UINT16_MAX
+    assert(Knot(generator.braidClosure(2, 32765)).isPlanar());
+    assert(!generator.braidClosure(20000, 2768).empty());
+    for (const pair<uint16_t, size_t> &tooLarge : vector<pair<uint16_t, size_t>>{{2, 32766}, {20000, 2769}, {20000, 12000}, {UINT16_MAX, 0}})
+    {
+        bool thrown = false;
+        try
+        {
+            generator.braidClosure(tooLarge.first, tooLarge.second);
+        }
+        catch (const kle::DiagramGenerationException &)
+        {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    // the same seed gives the same diagrams
+    DiagramGenerator first(7), second(7);
+    for (int i = 0; i < 10; i++)
+    {
+        vector<crossing> a = first.braidClosure(5, 60), b = second.braidClosure(5, 60);
+        assert(a.size() == b.size());
+        for (size_t j = 0; j < a.size(); j++)
+            assert(equal(a[j].arcs, a[j].arcs + 4, b[j].arcs) && a[j].sign == b[j].sign);
+    }
+    cout << endl << ".braidClosure() Tests [PASSED]" << endl << endl<< endl;
+
+    // every move adds one or two crossings
+    for (size_t moves = 0; moves < 50; moves += 7)
+    {
+        vector<crossing> pd = generator.inflate(trefoil, moves);
+        assert(pd.size() >= trefoil.size() + moves && pd.size() <= trefoil.size() + 2 * moves);
+        Knot inflated(pd);
+    }
+    Knot inflatedUnknot(generator.inflate(vector<crossing>{}, 20));
+
+    // every label of the base is checked, not only the incoming ones
+    const vector<vector<crossing>> inconsistent{{crossing(1, 60000, 2, 2)}, {crossing(1, 2, 2, 1)}, {crossing(1, 3, 2, 4), crossing(3, 1, 4, 2)}};
+    for (const vector<crossing> &bad : inconsistent)
+    {
+        for (int summand = 0; summand < 3; summand++)
+        {
+            bool thrown = false;
+            try
+            {
+                if (summand == 0)
+                    generator.inflate(bad, 3);
+                else
+                    generator.connectedSum(summand == 1 ? bad : trefoil, summand == 1 ? trefoil : bad);
+            }
+            catch (const kle::InconsistentPlanarDiagram &)
+            {
+                thrown = true;
+            }
+            assert(thrown);
+        }
+    }
+    cout << endl << ".inflate() Tests [PASSED]" << endl << endl<< endl;
+
+    vector<crossing> sum = generator.connectedSum(trefoil, generator.inflate(trefoil, 5));
+    assert(sum.size() >= 2 * trefoil.size() + 5);
+    Knot sumKnot(sum);
+    assert(generator.connectedSum(trefoil, vector<crossing>{}).size() == trefoil.size());
+    Knot randomSum(generator.connectedSum(4, 3, 12));
+    cout << endl << ".connectedSum() Tests [PASSED]" << endl << endl<< endl;
+
+    cout << "_____________________________________________________________________________" << endl;
+}
+
+void runKnotTests()
+{
+    cout << "_____________________________________________________________________________" << endl;
+    cout << "_________________________________[Knot Tests]________________________________" << endl;
+    DiagramGenerator generator(31);
+
+    Knot unknot;
+    Knot trefoil(vector<crossing>{crossing(1, 5, 2, 4), crossing(5, 3, 6, 2), crossing(3, 1, 4, 6)});
+    Knot figureEight(vector<crossing>{crossing(1, 5, 2, 4, true), crossing(7, 3, 8, 2, false),
+                                      crossing(5, 1, 6, 8, true), crossing(3, 7, 4, 6, false)});
+    assert(unknot.determinant() == 1);
+    assert(trefoil.determinant() == 3);
+    assert(figureEight.determinant() == 5);
+
+    // the determinant doesn't depend on the diagram
+    for (int i = 0; i < 20; i++)
+    {
+        assert(Knot(generator.inflate(trefoil.getPlanarDiagram(), i)).determinant() == 3);
+        assert(Knot(generator.inflate(figureEight.getPlanarDiagram(), i)).determinant() == 5);
+    }
+
+    // the determinant is multiplicative under connected sum, it stays exact past 2^53 and overflows past 2^64
+    vector<crossing> summands;
+    unsigned __int128 product = 1;
+    while (product <= UINT64_MAX)
+    {
+        const vector<crossing> summand = generator.braidClosure(5, 40);
+        product *= Knot(summand).determinant();
+        summands = generator.connectedSum(summands, summand);
+        if (product <= UINT64_MAX)
+            assert(Knot(summands).determinant() == (uint64_t)product);
+    }
+    assert(product > ((unsigned __int128)1 << 53));
+    bool overflow = false;
+    try
+    {
+        Knot(summands).determinant();
+    }
+    catch (const kle::InvariantOverflowException &)
+    {
+        overflow = true;
+    }
+    assert(overflow);
+    cout << endl << ".determinant() Tests [PASSED]" << endl << endl<< endl;
+
+    // one crossing change unknots the trefoil, a second one brings it back
+    trefoil.changeCrossing(0);
+    assert(trefoil.determinant() == 1);
+    trefoil.changeCrossing(0);
+    assert(trefoil.determinant() == 3);
+
+    // the updated factorization agrees with a new one
+    for (int i = 0; i < 10; i++)
+    {
+        Knot knot(generator.braidClosure(4, 30));
+        knot.determinant();
+        for (int j = 0; j < 60; j++)
+        {
+            knot.changeCrossing((7 * j + i) % knot.getPlanarDiagram().size());
+            assert(knot.determinant() == Knot(knot.getPlanarDiagram()).determinant());
+        }
+    }
+    cout << endl << ".changeCrossing() Tests [PASSED]" << endl << endl<< endl;
+
+    // undoing the moves of inflate() gives back the minimal diagrams
+    for (int i = 0; i < 20; i++)
+    {
+        Knot inflatedUnknot(generator.inflate(vector<crossing>(), i));
+        inflatedUnknot.reduce();
+        assert(inflatedUnknot.getPlanarDiagram().empty());
+
+        Knot inflatedTrefoil(generator.inflate(Knot(vector<crossing>{crossing(1, 5, 2, 4), crossing(5, 3, 6, 2), crossing(3, 1, 4, 6)}).getPlanarDiagram(), i));
+        inflatedTrefoil.determinant();
+        inflatedTrefoil.reduce();
+        assert(inflatedTrefoil.getPlanarDiagram().size() == 3 && inflatedTrefoil.isPlanar());
+        assert(inflatedTrefoil.determinant() == 3);
+    }
+    figureEight.reduce();
+    assert(figureEight.getPlanarDiagram().size() == 4);
+
+    // the downdated factorization agrees with a new one, also after crossing changes
+    for (int i = 0; i < 20; i++)
+    {
+        Knot knot(generator.inflate(generator.braidClosure(3 + i % 3, 20 + 2 * i), i % 4));
+        knot.determinant();
+        knot.reduce();
+        if (knot.getPlanarDiagram().empty())
+            continue;
+        assert(knot.determinant() == Knot(knot.getPlanarDiagram()).determinant());
+        for (int j = 0; j < 10; j++)
+        {
+            knot.changeCrossing((3 * j + i) % knot.getPlanarDiagram().size());
+            assert(knot.determinant() == Knot(knot.getPlanarDiagram()).determinant());
+        }
+    }
+    cout << endl << ".reduce() Tests [PASSED]" << endl << endl<< endl;
+
+    // Alexander polynomials against the table, on minimal and inflated diagrams
+    const Polynomial trefoilAlexander = findKnot("3_1")->alexander.toPolynomial();
+    const Polynomial figureEightAlexander = findKnot("4_1")->alexander.toPolynomial();
+    assert(unknot.alexanderPolynomial().isUnit());
+    assert(trefoil.alexanderPolynomial() == trefoilAlexander);
+    assert(figureEight.alexanderPolynomial() == figureEightAlexander);
+    for (int i = 0; i < 10; i++)
+    {
+        assert(Knot(generator.inflate(trefoil.getPlanarDiagram(), i)).alexanderPolynomial() == trefoilAlexander);
+        assert(Knot(generator.inflate(figureEight.getPlanarDiagram(), i)).alexanderPolynomial() == figureEightAlexander);
+    }
+    trefoil.changeCrossing(1);
+    assert(trefoil.alexanderPolynomial().isUnit());
+    trefoil.changeCrossing(1);
+
+    // Delta_2 of a connected sum is the gcd of the Alexander polynomials of the summands
+    Knot doubleTrefoil(generator.connectedSum(trefoil.getPlanarDiagram(), trefoil.getPlanarDiagram()));
+    Knot squareSum(generator.connectedSum(trefoil.getPlanarDiagram(), figureEight.getPlanarDiagram()));
+    assert(doubleTrefoil.alexanderPolynomial() == trefoilAlexander * trefoilAlexander);
+    assert(doubleTrefoil.alexanderPolynomial(2) == trefoilAlexander);
+    assert(doubleTrefoil.alexanderPolynomial(3).isUnit());
+    assert(squareSum.alexanderPolynomial() == findKnot("8_21")->alexander.toPolynomial());
+    assert(squareSum.alexanderPolynomial(2).isUnit());
+    assert(trefoil.alexanderPolynomial(2).isUnit() && figureEight.alexanderPolynomial(2).isUnit());
+    cout << endl << ".alexanderPolynomial() Tests [PASSED]" << endl << endl<< endl;
+
+    cout << "_____________________________________________________________________________" << endl;
+}
+
+void runGaussDiagramTests()
+{
+    cout << "_____________________________________________________________________________" << endl;
+    cout << "____________________________[Gauss Diagram Tests]___________________________" << endl;
+    DiagramGenerator generator(3);
+
+    Knot trefoil(vector<crossing>{crossing(1, 5, 2, 4), crossing(5, 3, 6, 2), crossing(3, 1, 4, 6)});
+    Knot mirrorTrefoil(vector<crossing>{crossing(4, 2, 5, 1, false), crossing(2, 6, 3, 5, false), crossing(6, 4, 1, 3, false)});
+    Knot figureEight(vector<crossing>{crossing(1, 5, 2, 4, true), crossing(7, 3, 8, 2, false),
+                                      crossing(5, 1, 6, 8, true), crossing(3, 7, 4, 6, false)});
+
+    assert(trefoil.gaussCode() == (vector<int32_t>{1, -2, 3, -1, 2, -3}));
+    assert(Knot().gaussCode().empty());
+
+    // labels 2 and 4 swapped: the code follows the crossings, not the label order
+    Knot relabeledTrefoil(vector<crossing>{crossing(1, 5, 4, 2), crossing(5, 3, 6, 4), crossing(3, 1, 2, 6)});
+    assert(relabeledTrefoil.gaussCode() == trefoil.gaussCode());
+    assert(GaussDiagram(relabeledTrefoil).v2() == 1 && GaussDiagram(relabeledTrefoil).v3() == 1);
+    cout << endl << ".gaussCode() Tests [PASSED]" << endl << endl<< endl;
+
+    assert(GaussDiagram(Knot()).v2() == 0 && GaussDiagram(Knot()).v3() == 0);
+    assert(GaussDiagram(trefoil).v2() == 1 && GaussDiagram(trefoil).v3() == 1);
+    assert(GaussDiagram(mirrorTrefoil).v2() == 1 && GaussDiagram(mirrorTrefoil).v3() == -1);
+    assert(GaussDiagram(figureEight).v2() == -1 && GaussDiagram(figureEight).v3() == 0);
+
+    // invariance and agreement with the direct formulas
+    for (int i = 0; i < 30; i++)
+    {
+        GaussDiagram inflatedTrefoil(Knot(generator.inflate(trefoil.getPlanarDiagram(), i)));
+        assert(inflatedTrefoil.v2() == 1 && inflatedTrefoil.v3() == 1);
+
+        GaussDiagram random(Knot(generator.inflate(generator.braidClosure(4, 12), i % 5)));
+        assert(random.v2() == random.v2BruteForce());
+        assert(random.v3() == random.v3BruteForce());
+
+        // long enough for the arcs to spread over several blocks of start positions
+        GaussDiagram large(Knot(generator.inflate(generator.braidClosure(2 + i % 5, 40 + 3 * i), i % 4)));
+        assert(large.v3() == large.v3BruteForce());
+    }
+    cout << endl << ".v2() .v3() Tests [PASSED]" << endl << endl<< endl;
+
+    cout << "_____________________________________________________________________________" << endl;
+}
+
+void runEnumeratorTests()
+{
+    cout << "_____________________________________________________________________________" << endl;
+    cout << "_____________________________[Enumerator Tests]_____________________________" << endl;
+
+    // prime reduced shadows and alternating knots (one bucket each) from 3 to 7 crossings
+    const vector<uint64_t> shadows{1, 1, 2, 3, 10}, alternatingKnots{1, 1, 2, 3, 7};
+    for (uint16_t crossings = 3; crossings <= 7; crossings++)
+    {
+        KnotEnumerator enumerator(crossings);
+        enumerator.run("", 4);
+        assert(enumerator.getShadowCount() == shadows[crossings - 3]);
+        assert(enumerator.getBuckets().size() == alternatingKnots[crossings - 3]);
+
+        for (const auto &[key, bucket] : enumerator.getBuckets())
+        {
+            Knot knot(KnotEnumerator::planarDiagram(bucket.dtCode, bucket.overMask));
+            assert(key.crossings == crossings && knot.determinant() == key.determinant);
+            assert(GaussDiagram(knot).v2() == key.v2);
+        }
+    }
+
+    KnotEnumerator trefoils(3);
+    trefoils.run("", 1);
+    const InvariantKey trefoilKey{3, 3, 1, 1};
+    assert(trefoils.getBuckets().begin()->first == trefoilKey);
+    assert(trefoils.getBuckets().begin()->second.dtCode == (vector<uint16_t>{4, 6, 2}));
+    cout << endl << ".run() Tests [PASSED]" << endl << endl<< endl;
+
+    // a resumed enumeration reads the finished subtrees back
+    const string checkpoint = "enumeration_test.checkpoint";
+    remove(checkpoint.c_str());
+    KnotEnumerator first(6, false);
+    first.run(checkpoint, 2);
+    KnotEnumerator resumed(6, false);
+    resumed.run(checkpoint, 2);
+    assert(first.getDiagramCount() == resumed.getDiagramCount() && first.getShadowCount() == resumed.getShadowCount());
+    assert(first.getBuckets().size() == resumed.getBuckets().size());
+    for (const auto &[key, bucket] : first.getBuckets())
+        assert(resumed.getBuckets().at(key).count == bucket.count && resumed.getBuckets().at(key).dtCode == bucket.dtCode);
+
+    bool mismatchDetected = false;
+    try
+    {
+        KnotEnumerator(7, false).run(checkpoint);
+    }
+    catch (const kle::CheckpointException &)
+    {
+        mismatchDetected = true;
+    }
+    assert(mismatchDetected);
+    remove(checkpoint.c_str());
+    cout << endl << "checkpoint Tests [PASSED]" << endl << endl<< endl;
+
+    cout << "_____________________________________________________________________________" << endl;
+}
+
+void runPipelineTests()
+{
+    cout << "_____________________________________________________________________________" << endl;
+    cout << "______________________________[Pipeline Tests]______________________________" << endl;
+
+    // every value goes through exactly once with several producers and consumers
+    BoundedQueue<uint64_t> queue(8);
+    assert(queue.capacity() == 8);
+    uint64_t value = 1;
+    for (int i = 0; i < 8; i++)
+        assert(queue.tryPush(value));
+    assert(!queue.tryPush(value));
+    for (int i = 0; i < 8; i++)
+        assert(queue.tryPop(value) && value == 1);
+    assert(!queue.tryPop(value));
+
+    const uint64_t perProducer = 20000;
+    atomic<uint64_t> sum{0};
+    vector<thread> workers;
+    for (uint64_t p = 0; p < 3; p++)
+        workers.emplace_back([&, p]() { for (uint64_t i = 1; i <= perProducer; i++) queue.push(p * perProducer + i); });
+    for (int c = 0; c < 3; c++)
+        workers.emplace_back([&]() { for (uint64_t i = 0; i < perProducer; i++) sum += queue.pop(); });
+    for (thread &worker : workers)
+        worker.join();
+    assert(sum == 3 * perProducer * (3 * perProducer + 1) / 2);
+
+    // threads parked on a full or an empty queue are woken up, two consumers waiting on the same slot
+    BoundedQueue<uint64_t> parking(2);
+    atomic<uint64_t> popped{0};
+    vector<thread> sleepers;
+    for (int c = 0; c < 2; c++)
+        sleepers.emplace_back([&]() { popped += parking.pop(); });
+    this_thread::sleep_for(chrono::milliseconds(50));
+    parking.push(1);
+    parking.push(2);
+    for (thread &sleeper : sleepers)
+        sleeper.join();
+    assert(popped == 3);
+
+    parking.push(3);
+    parking.push(4);
+    thread blockedProducer([&]() { parking.push(5); });
+    this_thread::sleep_for(chrono::milliseconds(50));
+    assert(parking.pop() == 3 && parking.pop() == 4);
+    blockedProducer.join();
+    assert(parking.pop() == 5 && !parking.tryPop(value));
+    cout << endl << "BoundedQueue Tests [PASSED]" << endl << endl<< endl;
+
+    string name;
+    assert(KnotPipeline::parseRecord("3_1 1 5 2 4 + 5 3 6 2 + 3 1 4 6 +", name).size() == 3 && name == "3_1");
+
+    // inflated copies reduce to the original diagram, bad records are reported and skipped
+    DiagramGenerator generator(5);
+    const vector<crossing> figureEight{crossing(1, 5, 2, 4, true), crossing(7, 3, 8, 2, false),
+                                       crossing(5, 1, 6, 8, true), crossing(3, 7, 4, 6, false)};
+    stringstream input, output;
+    input << "# name over_in under_out over_out under_in sign" << endl << endl;
+    for (int i = 0; i < 200; i++)
+    {
+        input << "4_1-" << i;
+        for (const crossing &c : generator.inflate(figureEight, i % 10))
+            input << " " << c.over_in() << " " << c.under_out() << " " << c.over_out() << " " << c.under_in() << (c.sign ? " +" : " -");
+        input << endl;
+    }
+    input << "truncated 1 5 2" << endl;
+    input << "link 1 3 2 4 + 3 1 4 2 +" << endl;
+
+    // a determinant past 2^64 is reported as an overflow, not as a wrapped number
+    vector<crossing> huge;
+    for (bool fits = true; fits;)
+    {
+        huge = generator.connectedSum(huge, generator.braidClosure(5, 40));
+        try
+        {
+            Knot(huge).determinant();
+        }
+        catch (const kle::InvariantOverflowException &)
+        {
+            fits = false;
+        }
+    }
+    input << "huge";
+    for (const crossing &c : huge)
+        input << " " << c.over_in() << " " << c.under_out() << " " << c.over_out() << " " << c.under_in() << (c.sign ? " +" : " -");
+    input << endl;
+
+    const PipelineStats stats = KnotPipeline(4, 3).run(input, output);
+    assert(stats.records == 203 && stats.rejected == 2);
+
+    size_t results = 0;
+    for (string line; getline(output, line);)
+    {
+        istringstream fields(line);
+        string record, column;
+        fields >> record >> name >> column;
+        if (column == "error")
+        {
+            assert(name == "truncated" || name == "link");
+            continue;
+        }
+        if (name == "huge")
+        {
+            string determinant;
+            int64_t v2 = 1, v3 = 1;
+            fields >> column >> determinant >> v2 >> v3;
+            assert(determinant == "overflow" && !fields.fail());
+            continue;
+        }
+
+        size_t reducedCrossings;
+        uint64_t determinant;
+        int64_t v2, v3;
+        fields >> reducedCrossings >> determinant >> v2 >> v3;
+        assert(name.rfind("4_1-", 0) == 0 && stoul(column) >= 4);
+        assert(reducedCrossings == 4 && determinant == 5 && v2 == -1 && v3 == 0);
+        results++;
+    }
+    assert(results == 200);
+    cout << endl << "KnotPipeline Tests [PASSED]" << endl << endl<< endl;
+
+    cout << "_____________________________________________________________________________" << endl;
+}
+
+void runKnotTableTests()
+{
+    cout << "_____________________________________________________________________________" << endl;
+    cout << "_____________________________[Knot Table Tests]_____________________________" << endl;
+
+    constexpr FixedPolynomial<8> a({1, 2}, -1), b({0, 3, 0, -1}, 0);
+    static_assert(a + b == FixedPolynomial<8>({1, 2, 3, 0, -1}, -1));
+    static_assert(a - a == FixedPolynomial<8>() && (a - a).getTrailingDegree() == 0);
+    static_assert(b.getTrailingDegree() == 1 && b.getLeadingDegree() == 3 && b.size() == 3);
+    static_assert(a * b == FixedPolynomial<8>({3, 6, -1, -2}, 0));
+    static_assert(a * b != b && (a * b).evaluate(2) == a.evaluate(2) * b.evaluate(2));
+
+    bool overflow = false;
+    try
+    {
+        FixedPolynomial<3>({1, 1}) * FixedPolynomial<3>({1, 1, 1});
+    }
+    catch (const kle::PolynomialBoundException &)
+    {
+        overflow = true;
+    }
+    assert(overflow);
+
+    const Polynomial figureEight = findKnot("4_1")->alexander.toPolynomial();
+    assert(figureEight.getTrailingDegree() == -1 && figureEight.getLeadingDegree() == 1);
+    assert(figureEight.getTerm(0) == (Term{-1, -1}) && figureEight.getTerm(1) == (Term{3, 0}));
+    cout << endl << "FixedPolynomial Tests [PASSED]" << endl << endl<< endl;
+
+    // the enumerated alternating knots are exactly the alternating entries of the table, up to knots sharing (det, v2)
+    for (uint16_t crossings = 3; crossings <= 10; crossings++)
+    {
+        KnotEnumerator enumerator(crossings);
+        enumerator.run("", 2);
+
+        set<pair<uint64_t, int64_t>> enumerated, expected;
+        for (const auto &[key, bucket] : enumerator.getBuckets())
+            enumerated.insert({key.determinant, key.v2});
+        for (const KnotTableEntry &entry : KNOT_TABLE)
+        {
+            if (entry.crossings == crossings && entry.alternating)
+                expected.insert({entry.determinant, secondConwayCoefficient(entry.alexander)});
+        }
+        assert(enumerated == expected);
+    }
+    assert(findKnot("10_124")->determinant == 1 && secondConwayCoefficient(findKnot("10_124")->alexander) == 8);
+    assert(findKnot("10_132")->alexander == findKnot("5_1")->alexander && findKnot("11_1") == nullptr);
+    cout << endl << "KNOT_TABLE Tests [PASSED]" << endl << endl<< endl;
+
+    cout << "_____________________________________________________________________________" << endl;
+}